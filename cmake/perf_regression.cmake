@@ -0,0 +1,34 @@
+# header-begin ------------------------------------------
+# File       : perf_regression.cmake
+#
+# Author      : Joshua E
+# Email       : estesjn2020@gmail.com
+#
+# Created on  : 10/19/2026
+#
+# Comments:
+#      Runs complex_benchmark and writes its JSON results to
+#      RESULTS. Behind the perf_benchmark test, whose results
+#      perf_regression then compares with the baseline, and
+#      the perf_baseline target, which writes the baseline
+#      itself. Expects BENCHMARK and RESULTS to be passed
+#      with -D.
+#
+# header-end --------------------------------------------
+
+get_filename_component(_results_dir ${RESULTS} DIRECTORY)
+file(MAKE_DIRECTORY ${_results_dir})
+
+execute_process(
+  COMMAND ${BENCHMARK} --format json --min-time 100
+  OUTPUT_FILE ${RESULTS}
+  RESULT_VARIABLE _status)
+if(NOT _status EQUAL 0)
+  message(FATAL_ERROR "complex_benchmark failed (${_status})")
+endif()
+message(STATUS "benchmark results written to ${RESULTS}")
+
+# footer-begin ------------------------------------------
+# default.PlainText
+# File       : perf_regression.cmake
+# footer-end --------------------------------------------
@@ -0,0 +1,303 @@
+// header-begin ------------------------------------------
+// File       : array.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Contiguous, allocator-aware containers for batches of
+//      numbers: a one dimensional array and a row-major
+//      matrix. Both are contiguous ranges, so they convert
+//      to std::span and can be passed directly to the
+//      kernels in batch.hpp. The pmr aliases take their
+//      storage from any std::pmr::memory_resource, such as
+//      an arena; the numa aliases spread large buffers over
+//      the NUMA nodes of a thread pool.
+//
+// header-end --------------------------------------------
+
+#ifndef ARRAY_HPP
+#define ARRAY_HPP
+
+#include "memory.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <memory_resource>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace hypercomplex
+{
+// Class Forward Decleration
+template <typename _Tp, typename _Alloc = aligned_allocator<_Tp>> class array;
+template <typename _Tp, typename _Alloc = aligned_allocator<_Tp>> class matrix;
+
+namespace pmr
+{
+template <typename _Tp> using array = hypercomplex::array<_Tp, std::pmr::polymorphic_allocator<_Tp>>;
+template <typename _Tp> using matrix = hypercomplex::matrix<_Tp, std::pmr::polymorphic_allocator<_Tp>>;
+} // namespace pmr
+// Containers whose large buffers are spread over the NUMA nodes of the
+// pool they are given (default_pool() otherwise), see
+// first_touch_allocator
+namespace numa
+{
+template <typename _Tp> using array = hypercomplex::array<_Tp, first_touch_allocator<_Tp>>;
+template <typename _Tp> using matrix = hypercomplex::matrix<_Tp, first_touch_allocator<_Tp>>;
+} // namespace numa
+
+template <typename _Tp, typename _Alloc> class array
+{
+  private:
+	std::vector<_Tp, _Alloc> _data;
+
+  public:
+	using value_type = _Tp;
+	using allocator_type = _Alloc;
+	using size_type = std::size_t;
+	using reference = _Tp &;
+	using const_reference = const _Tp &;
+	using pointer = _Tp *;
+	using const_pointer = const _Tp *;
+	using iterator = typename std::vector<_Tp, _Alloc>::iterator;
+	using const_iterator = typename std::vector<_Tp, _Alloc>::const_iterator;
+
+	array() = default;
+	explicit array(const _Alloc &_alloc) : _data(_alloc) {}
+	explicit array(size_type _n, const _Alloc &_alloc = _Alloc()) : _data(_n, _alloc) {}
+	array(size_type _n, const _Tp &_value, const _Alloc &_alloc = _Alloc()) : _data(_n, _value, _alloc) {}
+	array(std::initializer_list<_Tp> _init, const _Alloc &_alloc = _Alloc()) : _data(_init, _alloc) {}
+	array(std::span<const _Tp> _values, const _Alloc &_alloc = _Alloc())
+		: _data(_values.begin(), _values.end(), _alloc)
+	{
+	}
+	array(const array &) = default;
+	array(const array &_other, const _Alloc &_alloc) : _data(_other._data, _alloc) {}
+	array(array &&) noexcept = default;
+	array(array &&_other, const _Alloc &_alloc) : _data(std::move(_other._data), _alloc) {}
+	array &operator=(const array &) = default;
+	array &operator=(array &&) = default;
+
+	inline allocator_type
+	get_allocator() const
+	{
+		return _data.get_allocator();
+	}
+
+	inline pointer
+	data() noexcept
+	{
+		return _data.data();
+	}
+	inline const_pointer
+	data() const noexcept
+	{
+		return _data.data();
+	}
+	inline size_type
+	size() const noexcept
+	{
+		return _data.size();
+	}
+	inline bool
+	empty() const noexcept
+	{
+		return _data.empty();
+	}
+	inline size_type
+	capacity() const noexcept
+	{
+		return _data.capacity();
+	}
+	inline void
+	reserve(size_type _n)
+	{
+		_data.reserve(_n);
+	}
+	inline void
+	resize(size_type _n)
+	{
+		_data.resize(_n);
+	}
+	inline void
+	resize(size_type _n, const _Tp &_value)
+	{
+		_data.resize(_n, _value);
+	}
+	inline void
+	clear() noexcept
+	{
+		_data.clear();
+	}
+
+	inline reference
+	operator[](size_type _i)
+	{
+		assert(_i < _data.size());
+		return _data[_i];
+	}
+	inline const_reference
+	operator[](size_type _i) const
+	{
+		assert(_i < _data.size());
+		return _data[_i];
+	}
+
+	inline iterator
+	begin() noexcept
+	{
+		return _data.begin();
+	}
+	inline const_iterator
+	begin() const noexcept
+	{
+		return _data.begin();
+	}
+	inline iterator
+	end() noexcept
+	{
+		return _data.end();
+	}
+	inline const_iterator
+	end() const noexcept
+	{
+		return _data.end();
+	}
+};
+
+// Row-major storage, element (r, c) lives at data()[r * cols() + c]
+template <typename _Tp, typename _Alloc> class matrix
+{
+  private:
+	std::size_t _rows = 0, _cols = 0;
+	std::vector<_Tp, _Alloc> _data;
+
+  public:
+	using value_type = _Tp;
+	using allocator_type = _Alloc;
+	using size_type = std::size_t;
+	using reference = _Tp &;
+	using const_reference = const _Tp &;
+	using pointer = _Tp *;
+	using const_pointer = const _Tp *;
+
+	matrix() = default;
+	explicit matrix(const _Alloc &_alloc) : _data(_alloc) {}
+	matrix(size_type _r, size_type _c, const _Alloc &_alloc = _Alloc()) : _rows(_r), _cols(_c), _data(_r * _c, _alloc)
+	{
+	}
+	matrix(size_type _r, size_type _c, const _Tp &_value, const _Alloc &_alloc = _Alloc())
+		: _rows(_r), _cols(_c), _data(_r * _c, _value, _alloc)
+	{
+	}
+	matrix(const matrix &) = default;
+	matrix(const matrix &_other, const _Alloc &_alloc)
+		: _rows(_other._rows), _cols(_other._cols), _data(_other._data, _alloc)
+	{
+	}
+	matrix(matrix &&) noexcept = default;
+	matrix &operator=(const matrix &) = default;
+	matrix &operator=(matrix &&) = default;
+
+	inline allocator_type
+	get_allocator() const
+	{
+		return _data.get_allocator();
+	}
+
+	inline size_type
+	rows() const noexcept
+	{
+		return _rows;
+	}
+	inline size_type
+	cols() const noexcept
+	{
+		return _cols;
+	}
+	inline size_type
+	size() const noexcept
+	{
+		return _data.size();
+	}
+	// Distance between the starts of consecutive rows
+	inline size_type
+	stride() const noexcept
+	{
+		return _cols;
+	}
+	inline pointer
+	data() noexcept
+	{
+		return _data.data();
+	}
+	inline const_pointer
+	data() const noexcept
+	{
+		return _data.data();
+	}
+	inline void
+	resize(size_type _r, size_type _c)
+	{
+		_rows = _r;
+		_cols = _c;
+		_data.resize(_r * _c);
+	}
+
+	inline reference
+	operator()(size_type _r, size_type _c)
+	{
+		assert(_r < _rows && _c < _cols);
+		return _data[_r * _cols + _c];
+	}
+	inline const_reference
+	operator()(size_type _r, size_type _c) const
+	{
+		assert(_r < _rows && _c < _cols);
+		return _data[_r * _cols + _c];
+	}
+
+	inline std::span<_Tp>
+	row(size_type _r) noexcept
+	{
+		return std::span<_Tp>(_data.data() + _r * _cols, _cols);
+	}
+	inline std::span<const _Tp>
+	row(size_type _r) const noexcept
+	{
+		return std::span<const _Tp>(_data.data() + _r * _cols, _cols);
+	}
+
+	inline pointer
+	begin() noexcept
+	{
+		return _data.data();
+	}
+	inline const_pointer
+	begin() const noexcept
+	{
+		return _data.data();
+	}
+	inline pointer
+	end() noexcept
+	{
+		return _data.data() + _data.size();
+	}
+	inline const_pointer
+	end() const noexcept
+	{
+		return _data.data() + _data.size();
+	}
+};
+} // namespace hypercomplex
+#endif // ARRAY_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : array.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,754 @@
+// header-begin ------------------------------------------
+// File       : batch.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Batch kernels over contiguous spans of complex numbers.
+//      The inner loops are written without data dependent
+//      branches (special values are resolved with selects)
+//      so that the compiler can vectorize them (GCC needs
+//      -fno-math-errno -fno-trapping-math to if-convert them).
+//
+// header-end --------------------------------------------
+
+#ifndef BATCH_HPP
+#define BATCH_HPP
+
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace hypercomplex
+{
+// Accuracy Selection
+//      fast     : atan2 within 6.1e-4 rad, sin/cos within 4e-5
+//      balanced : atan2 within 3.8e-8 rad, sin/cos within 2e-9
+//      precise  : the C library (std::hypot, std::atan2, ...)
+// The approximations reduce sin/cos arguments in _UnderlyingType,
+// so they lose accuracy once |theta| grows past about 1e5.
+enum class accuracy
+{
+	fast,
+	balanced,
+	precise
+};
+
+// Batch Polar Conversion
+template <typename _UnderlyingType>
+void to_polar(std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::span<_UnderlyingType>,
+			  std::span<_UnderlyingType>, accuracy = accuracy::precise);
+template <typename _UnderlyingType>
+void from_polar(std::span<const std::type_identity_t<_UnderlyingType>>,
+				std::span<const std::type_identity_t<_UnderlyingType>>, std::span<complex<_UnderlyingType>>,
+				accuracy = accuracy::precise);
+
+// Batch Arithmetic
+template <typename _UnderlyingType>
+void add(std::span<const complex<std::type_identity_t<_UnderlyingType>>>,
+		 std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::span<complex<_UnderlyingType>>);
+template <typename _UnderlyingType>
+void subtract(std::span<const complex<std::type_identity_t<_UnderlyingType>>>,
+			  std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::span<complex<_UnderlyingType>>);
+template <typename _UnderlyingType>
+void multiply(std::span<const complex<std::type_identity_t<_UnderlyingType>>>,
+			  std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::span<complex<_UnderlyingType>>);
+template <typename _UnderlyingType>
+void divide(std::span<const complex<std::type_identity_t<_UnderlyingType>>>,
+			std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::span<complex<_UnderlyingType>>);
+
+// Batch Power
+// The exponent is shared by the whole batch, so the method (binary
+// exponentiation, polar form or exp/log) is chosen once per call.
+template <typename _UnderlyingType, std::integral _Integer>
+void pow(std::span<const complex<std::type_identity_t<_UnderlyingType>>>, _Integer, std::span<complex<_UnderlyingType>>);
+template <typename _UnderlyingType>
+void pow(std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::type_identity_t<_UnderlyingType>,
+		 std::span<complex<_UnderlyingType>>, accuracy = accuracy::precise);
+template <typename _UnderlyingType>
+void pow(std::span<const complex<std::type_identity_t<_UnderlyingType>>>,
+		 const complex<std::type_identity_t<_UnderlyingType>> &, std::span<complex<_UnderlyingType>>,
+		 accuracy = accuracy::precise);
+
+// Every batch function also has an overload taking an execution policy
+// (execution::seq, execution::par, execution::par_unseq) as its first
+// argument, declared with its definition below.
+
+namespace __detail
+{
+// Overflow safe magnitude, max(|x|,|y|) * sqrt(1 + (min/max)^2).
+// Infinity wins over NaN, matching std::hypot. A NaN compares false, so
+// it always lands in _min when _max is zero.
+template <typename _UnderlyingType>
+inline _UnderlyingType
+__hypot(_UnderlyingType _x, _UnderlyingType _y)
+{
+	constexpr _UnderlyingType _inf = std::numeric_limits<_UnderlyingType>::infinity();
+	const _UnderlyingType _ax = std::abs(_x), _ay = std::abs(_y);
+	const _UnderlyingType _max = _ax > _ay ? _ax : _ay;
+	const _UnderlyingType _min = _ax > _ay ? _ay : _ax;
+	const _UnderlyingType _q = _min / _max;
+	_UnderlyingType _r = _max * std::sqrt(_UnderlyingType(1) + _q * _q);
+	_r = _max == _UnderlyingType(0) ? _min : _r;
+	_r = (_ax == _inf) | (_ay == _inf) ? _inf : _r;
+	return _r;
+}
+
+// atan on [0, 1] as x * P(x^2), coefficients fitted for minimum
+// absolute error.
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline _UnderlyingType
+__atan_unit(_UnderlyingType _a)
+{
+	const _UnderlyingType _s = _a * _a;
+	if constexpr (_Accuracy == accuracy::fast)
+	{
+		return _a
+			   * (_UnderlyingType(0.99535792794874525L)
+				  + _s * (_UnderlyingType(-0.28869007144684696L) + _s * _UnderlyingType(0.079338870907010459L)));
+	}
+	else
+	{
+		_UnderlyingType _p = _UnderlyingType(-0.0040545573983226347L);
+		_p = _p * _s + _UnderlyingType(0.021862924551149913L);
+		_p = _p * _s + _UnderlyingType(-0.055912282477479701L);
+		_p = _p * _s + _UnderlyingType(0.09642194431857065L);
+		_p = _p * _s + _UnderlyingType(-0.13908628597756315L);
+		_p = _p * _s + _UnderlyingType(0.1994656551212307L);
+		_p = _p * _s + _UnderlyingType(-0.33329860779275575L);
+		_p = _p * _s + _UnderlyingType(0.99999933558064296L);
+		return _a * _p;
+	}
+}
+
+// Branch free atan2 following the std::atan2 conventions for signed
+// zeros, infinities and NaN.
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline _UnderlyingType
+__atan2(_UnderlyingType _y, _UnderlyingType _x)
+{
+	constexpr _UnderlyingType _inf = std::numeric_limits<_UnderlyingType>::infinity();
+	const _UnderlyingType _ax = std::abs(_x), _ay = std::abs(_y);
+	const _UnderlyingType _max = _ax > _ay ? _ax : _ay;
+	const _UnderlyingType _min = _ax > _ay ? _ay : _ax;
+	_UnderlyingType _a = _min / _max;
+	_a = _max == _UnderlyingType(0) ? _min : _a;
+	_a = (_ax == _inf) & (_ay == _inf) ? _UnderlyingType(1) : _a;
+
+	_UnderlyingType _r = __atan_unit<_Accuracy>(_a);
+	_r = _ay > _ax ? static_cast<_UnderlyingType>(__pi_2) - _r : _r;
+	_r = std::signbit(_x) ? static_cast<_UnderlyingType>(__pi) - _r : _r;
+	return std::copysign(_r, _y);
+}
+
+// Quadrant of a rounded reduction multiple. float and double read it
+// out of the mantissa of the round-to-nearest sum so that the loop
+// stays in vector registers.
+template <typename _UnderlyingType>
+inline unsigned
+__quadrant(_UnderlyingType _shifted, _UnderlyingType _k)
+{
+	if constexpr (std::is_same_v<_UnderlyingType, float>)
+	{
+		return std::bit_cast<std::uint32_t>(_shifted) & 3u;
+	}
+	else if constexpr (std::is_same_v<_UnderlyingType, double>)
+	{
+		return static_cast<unsigned>(std::bit_cast<std::uint64_t>(_shifted) & 3u);
+	}
+	else
+	{
+		const _UnderlyingType _safe = std::abs(_k) < _UnderlyingType(1e15L) ? _k : _UnderlyingType(0);
+		return static_cast<unsigned>(static_cast<long long>(_safe) & 3);
+	}
+}
+
+// sin and cos evaluated together with a Cody-Waite reduction to
+// [-pi/4, pi/4].
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__sincos(_UnderlyingType _x, _UnderlyingType &_sin, _UnderlyingType &_cos)
+{
+	// 1.5 * 2^(digits - 1): adding it rounds to an integer in the low mantissa bits
+	constexpr _UnderlyingType _round = std::is_same_v<_UnderlyingType, float> ? _UnderlyingType(12582912.0L)
+																			   : _UnderlyingType(6755399441055744.0L);
+	constexpr _UnderlyingType _two_over_pi = static_cast<_UnderlyingType>(1.0L / __pi_2);
+	// pi/2 split in three; the leading parts have enough trailing zero
+	// bits that k * part is exact for the supported range of k
+	constexpr bool _is_float = std::is_same_v<_UnderlyingType, float>;
+	constexpr _UnderlyingType _pi_2_hi
+		= _is_float ? _UnderlyingType(1.5703125L) : _UnderlyingType(1.57079625129699707031L);
+	constexpr _UnderlyingType _pi_2_mid
+		= _is_float ? _UnderlyingType(4.837512969970703125e-4L) : _UnderlyingType(7.54978941586159635336e-8L);
+	constexpr _UnderlyingType _pi_2_lo = static_cast<_UnderlyingType>(
+		__pi_2 - static_cast<long double>(_pi_2_hi) - static_cast<long double>(_pi_2_mid));
+
+	_UnderlyingType _shifted, _k;
+	if constexpr (std::numeric_limits<_UnderlyingType>::digits <= 53)
+	{
+		_shifted = _x * _two_over_pi + _round;
+		_k = _shifted - _round;
+	}
+	else
+	{
+		_k = std::nearbyint(_x * _two_over_pi);
+		_shifted = _k;
+	}
+	const _UnderlyingType _r = ((_x - _k * _pi_2_hi) - _k * _pi_2_mid) - _k * _pi_2_lo;
+	const _UnderlyingType _r2 = _r * _r;
+
+	_UnderlyingType _s, _c;
+	if constexpr (_Accuracy == accuracy::fast)
+	{
+		_s = _r * (_UnderlyingType(1) + _r2 * (_UnderlyingType(-1.0L / 6) + _r2 * _UnderlyingType(1.0L / 120)));
+		_c = _UnderlyingType(1)
+			 + _r2
+				   * (_UnderlyingType(-0.5L)
+					  + _r2 * (_UnderlyingType(1.0L / 24) + _r2 * _UnderlyingType(-1.0L / 720)));
+	}
+	else
+	{
+		_s = _UnderlyingType(1.0L / 362880);
+		_s = _s * _r2 + _UnderlyingType(-1.0L / 5040);
+		_s = _s * _r2 + _UnderlyingType(1.0L / 120);
+		_s = _s * _r2 + _UnderlyingType(-1.0L / 6);
+		_s = _r + _r * _r2 * _s;
+		_c = _UnderlyingType(-1.0L / 3628800);
+		_c = _c * _r2 + _UnderlyingType(1.0L / 40320);
+		_c = _c * _r2 + _UnderlyingType(-1.0L / 720);
+		_c = _c * _r2 + _UnderlyingType(1.0L / 24);
+		_c = _c * _r2 + _UnderlyingType(-0.5L);
+		_c = _UnderlyingType(1) + _r2 * _c;
+	}
+
+	const unsigned _q = __quadrant(_shifted, _k);
+	const _UnderlyingType _ss = (_q & 1u) ? _c : _s;
+	const _UnderlyingType _cc = (_q & 1u) ? _s : _c;
+	_sin = (_q & 2u) ? -_ss : _ss;
+	_cos = ((_q + 1u) & 2u) ? -_cc : _cc;
+}
+
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__to_polar(const complex<_UnderlyingType> *_in, _UnderlyingType *_mag, _UnderlyingType *_phase, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		const _UnderlyingType _x = _in[_i].real(), _y = _in[_i].imag();
+		if constexpr (_Accuracy == accuracy::precise)
+		{
+			_mag[_i] = std::hypot(_x, _y);
+			_phase[_i] = std::atan2(_y, _x);
+		}
+		else
+		{
+			_mag[_i] = __hypot(_x, _y);
+			_phase[_i] = __atan2<_Accuracy>(_y, _x);
+		}
+	}
+}
+
+// (|rho| cos theta, |rho| sin theta). A sin or cos that is exactly zero
+// is kept as is, so an infinite rho gives a signed zero rather than
+// inf * 0 = NaN in that component; a NaN rho or a non-finite theta
+// gives (NaN, NaN). Unlike polar() an infinite rho is not special
+// cased to (rho, sin theta).
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__from_polar(const _UnderlyingType *_rho, const _UnderlyingType *_theta, complex<_UnderlyingType> *_out, std::size_t _n)
+{
+	constexpr _UnderlyingType _inf = std::numeric_limits<_UnderlyingType>::infinity();
+	constexpr _UnderlyingType _nan = std::numeric_limits<_UnderlyingType>::quiet_NaN();
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		const _UnderlyingType _m = std::abs(_rho[_i]), _t = _theta[_i];
+		_UnderlyingType _s, _c;
+		if constexpr (_Accuracy == accuracy::precise)
+		{
+			_s = std::sin(_t);
+			_c = std::cos(_t);
+		}
+		else
+		{
+			__sincos<_Accuracy>(_t, _s, _c);
+		}
+		_UnderlyingType _r = _c == _UnderlyingType(0) ? _c : _m * _c;
+		_UnderlyingType _im = _s == _UnderlyingType(0) ? _s : _m * _s;
+		const bool _invalid = (_m != _m) | (_t != _t) | (std::abs(_t) == _inf);
+		_r = _invalid ? _nan : _r;
+		_im = _invalid ? _nan : _im;
+		_out[_i] = complex<_UnderlyingType>(_r, _im);
+	}
+}
+
+// z^e for a shared unsigned exponent, or (1 / z)^e when _invert. The
+// bits of e drive the same square / multiply sequence for every
+// element, so each step is a straight loop over a block of split real
+// and imaginary parts.
+template <typename _UnderlyingType>
+inline void
+__pow_integer(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n,
+			  unsigned long long _e, bool _invert)
+{
+	constexpr std::size_t _block = 64;
+	_UnderlyingType _zr[_block], _zi[_block], _r[_block], _i[_block];
+	const unsigned long long _top = _e == 0 ? 0 : std::bit_floor(_e) >> 1;
+	for (std::size_t _b = 0; _b < _n; _b += _block)
+	{
+		const std::size_t _m = _n - _b < _block ? _n - _b : _block;
+		for (std::size_t _l = 0; _l < _m; ++_l)
+		{
+			const complex<_UnderlyingType> _z = _invert ? __reciprocal(_in[_b + _l]) : _in[_b + _l];
+			_zr[_l] = _z.real();
+			_zi[_l] = _z.imag();
+			_r[_l] = _e == 0 ? _UnderlyingType(1) : _zr[_l];
+			_i[_l] = _e == 0 ? _UnderlyingType(0) : _zi[_l];
+		}
+		for (unsigned long long _bit = _top; _bit != 0; _bit >>= 1)
+		{
+			for (std::size_t _l = 0; _l < _m; ++_l)
+			{
+				const _UnderlyingType _sr = _r[_l] * _r[_l] - _i[_l] * _i[_l];
+				_i[_l] = (_r[_l] + _r[_l]) * _i[_l];
+				_r[_l] = _sr;
+			}
+			if (_e & _bit)
+			{
+				for (std::size_t _l = 0; _l < _m; ++_l)
+				{
+					const _UnderlyingType _mr = _r[_l] * _zr[_l] - _i[_l] * _zi[_l];
+					_i[_l] = _r[_l] * _zi[_l] + _i[_l] * _zr[_l];
+					_r[_l] = _mr;
+				}
+			}
+		}
+		for (std::size_t _l = 0; _l < _m; ++_l)
+		{
+			_out[_b + _l] = complex<_UnderlyingType>(_r[_l], _i[_l]);
+		}
+	}
+}
+
+template <typename _UnderlyingType, typename _Integer>
+inline void
+__pow_integer(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n, _Integer _e)
+{
+	const unsigned long long _m = static_cast<unsigned long long>(_e);
+	if constexpr (std::is_signed_v<_Integer>)
+	{
+		__pow_integer(_in, _out, _n, _e < 0 ? 0ull - _m : _m, _e < 0);
+	}
+	else
+	{
+		__pow_integer(_in, _out, _n, _m, false);
+	}
+}
+
+// |z|^x * (cos x*arg z, i sin x*arg z) with the same special value
+// handling as the scalar pow(). The precise variant matches it exactly.
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__pow_real(const complex<_UnderlyingType> *_in, _UnderlyingType _x, complex<_UnderlyingType> *_out, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		const _UnderlyingType _a = _in[_i].real(), _b = _in[_i].imag();
+		_UnderlyingType _mag, _t, _s, _c;
+		if constexpr (_Accuracy == accuracy::precise)
+		{
+			_mag = std::hypot(_a, _b);
+			_t = _x * std::atan2(_b, _a);
+			_c = std::cos(_t);
+			_s = std::sin(_t);
+		}
+		else
+		{
+			_mag = __hypot(_a, _b);
+			_t = _x * __atan2<_Accuracy>(_b, _a);
+			__sincos<_Accuracy>(_t, _s, _c);
+		}
+		const _UnderlyingType _m = std::pow(_mag, _x);
+		_out[_i] = complex<_UnderlyingType>(_c == _UnderlyingType(0) ? _c : _m * _c,
+											_s == _UnderlyingType(0) ? _s : _m * _s);
+	}
+}
+
+// exp(w * log z) for w = c + di with d != 0. A zero base gives
+// __pow_zero(w), as the scalar pow() does.
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__pow_complex(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> _w, complex<_UnderlyingType> *_out,
+			  std::size_t _n)
+{
+	const _UnderlyingType _wc = _w.real(), _wd = _w.imag();
+	const complex<_UnderlyingType> _at_zero = __pow_zero(_w);
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		const _UnderlyingType _a = _in[_i].real(), _b = _in[_i].imag();
+		_UnderlyingType _lr, _th;
+		if constexpr (_Accuracy == accuracy::precise)
+		{
+			_lr = std::log(std::hypot(_a, _b));
+			_th = std::atan2(_b, _a);
+		}
+		else
+		{
+			_lr = std::log(__hypot(_a, _b));
+			_th = __atan2<_Accuracy>(_b, _a);
+		}
+		const _UnderlyingType _u = _wc * _lr - _wd * _th;
+		const _UnderlyingType _t = _wc * _th + _wd * _lr;
+		const _UnderlyingType _m = std::exp(_u);
+		_UnderlyingType _s, _c;
+		if constexpr (_Accuracy == accuracy::precise)
+		{
+			_c = std::cos(_t);
+			_s = std::sin(_t);
+		}
+		else
+		{
+			__sincos<_Accuracy>(_t, _s, _c);
+		}
+		const bool _zero = (_a == _UnderlyingType(0)) & (_b == _UnderlyingType(0));
+		const _UnderlyingType _r = _m * _c;
+		const _UnderlyingType _im = _t == _UnderlyingType(0) ? _t : _m * _s;
+		_out[_i] = complex<_UnderlyingType>(_zero ? _at_zero.real() : _r, _zero ? _at_zero.imag() : _im);
+	}
+}
+
+// Smallest batch worth splitting for the per element libm / polynomial
+// kernels, which cost tens of cycles per element
+constexpr std::size_t __transcendental_grain = __default_grain / 8;
+
+template <typename _UnderlyingType, typename _Operation>
+inline void
+__elementwise(const complex<_UnderlyingType> *_a, const complex<_UnderlyingType> *_b, complex<_UnderlyingType> *_out,
+			  std::size_t _n, _Operation _op)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_out[_i] = _op(_a[_i], _b[_i]);
+	}
+}
+
+struct __add
+{
+	template <typename _Tp>
+	constexpr _Tp
+	operator()(const _Tp &_a, const _Tp &_b) const
+	{
+		return _a + _b;
+	}
+};
+struct __subtract
+{
+	template <typename _Tp>
+	constexpr _Tp
+	operator()(const _Tp &_a, const _Tp &_b) const
+	{
+		return _a - _b;
+	}
+};
+struct __multiply
+{
+	template <typename _Tp>
+	constexpr _Tp
+	operator()(const _Tp &_a, const _Tp &_b) const
+	{
+		return _a * _b;
+	}
+};
+struct __divide
+{
+	template <typename _Tp>
+	constexpr _Tp
+	operator()(const _Tp &_a, const _Tp &_b) const
+	{
+		return _a / _b;
+	}
+};
+
+template <typename _Policy, typename _UnderlyingType, typename _Operation>
+inline void
+__elementwise(const _Policy &_policy, std::span<const complex<_UnderlyingType>> _a,
+			  std::span<const complex<_UnderlyingType>> _b, std::span<complex<_UnderlyingType>> _out, _Operation _op)
+{
+	assert(_a.size() == _b.size() && _out.size() >= _a.size());
+	__for_each_chunk(_policy, _a.size(), [&](std::size_t _begin, std::size_t _end)
+					 { __elementwise(_a.data() + _begin, _b.data() + _begin, _out.data() + _begin, _end - _begin, _op); });
+}
+} // namespace __detail
+
+// Batch Arithmetic
+template <typename _UnderlyingType>
+void
+add(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+	std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(execution::seq, _a, _b, _out, __detail::__add{});
+}
+template <typename _UnderlyingType>
+void
+subtract(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+		 std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(execution::seq, _a, _b, _out, __detail::__subtract{});
+}
+template <typename _UnderlyingType>
+void
+multiply(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+		 std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(execution::seq, _a, _b, _out, __detail::__multiply{});
+}
+template <typename _UnderlyingType>
+void
+divide(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+	   std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(execution::seq, _a, _b, _out, __detail::__divide{});
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+add(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+	std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(_policy, _a, _b, _out, __detail::__add{});
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+subtract(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+		 std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(_policy, _a, _b, _out, __detail::__subtract{});
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+multiply(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+		 std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(_policy, _a, _b, _out, __detail::__multiply{});
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+divide(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+	   std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b, std::span<complex<_UnderlyingType>> _out)
+{
+	__detail::__elementwise(_policy, _a, _b, _out, __detail::__divide{});
+}
+
+// Batch Polar Conversion
+template <typename _UnderlyingType>
+void
+to_polar(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in, std::span<_UnderlyingType> _mag,
+		 std::span<_UnderlyingType> _phase, accuracy _acc)
+{
+	assert(_mag.size() >= _in.size() && _phase.size() >= _in.size());
+	__HYPERCOMPLEX_COUNT(abs, _in.size());
+	__HYPERCOMPLEX_COUNT(arg, _in.size());
+	switch (_acc)
+	{
+	case accuracy::fast:
+		__detail::__to_polar<accuracy::fast>(_in.data(), _mag.data(), _phase.data(), _in.size());
+		break;
+	case accuracy::balanced:
+		__detail::__to_polar<accuracy::balanced>(_in.data(), _mag.data(), _phase.data(), _in.size());
+		break;
+	case accuracy::precise:
+		__detail::__to_polar<accuracy::precise>(_in.data(), _mag.data(), _phase.data(), _in.size());
+		break;
+	}
+}
+template <typename _UnderlyingType>
+void
+from_polar(std::span<const std::type_identity_t<_UnderlyingType>> _rho,
+		   std::span<const std::type_identity_t<_UnderlyingType>> _theta, std::span<complex<_UnderlyingType>> _out,
+		   accuracy _acc)
+{
+	assert(_rho.size() == _theta.size() && _out.size() >= _rho.size());
+	__HYPERCOMPLEX_COUNT(polar, _rho.size());
+	switch (_acc)
+	{
+	case accuracy::fast:
+		__detail::__from_polar<accuracy::fast>(_rho.data(), _theta.data(), _out.data(), _rho.size());
+		break;
+	case accuracy::balanced:
+		__detail::__from_polar<accuracy::balanced>(_rho.data(), _theta.data(), _out.data(), _rho.size());
+		break;
+	case accuracy::precise:
+		__detail::__from_polar<accuracy::precise>(_rho.data(), _theta.data(), _out.data(), _rho.size());
+		break;
+	}
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+to_polar(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in,
+		 std::span<_UnderlyingType> _mag, std::span<_UnderlyingType> _phase, accuracy _acc = accuracy::precise)
+{
+	assert(_mag.size() >= _in.size() && _phase.size() >= _in.size());
+	__detail::__for_each_chunk(
+		_policy, _in.size(),
+		[&](std::size_t _begin, std::size_t _end)
+		{
+			to_polar<_UnderlyingType>(_in.subspan(_begin, _end - _begin), _mag.subspan(_begin, _end - _begin),
+									  _phase.subspan(_begin, _end - _begin), _acc);
+		},
+		__detail::__transcendental_grain);
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+from_polar(const _Policy &_policy, std::span<const std::type_identity_t<_UnderlyingType>> _rho,
+		   std::span<const std::type_identity_t<_UnderlyingType>> _theta, std::span<complex<_UnderlyingType>> _out,
+		   accuracy _acc = accuracy::precise)
+{
+	assert(_rho.size() == _theta.size() && _out.size() >= _rho.size());
+	__detail::__for_each_chunk(
+		_policy, _rho.size(),
+		[&](std::size_t _begin, std::size_t _end)
+		{
+			from_polar<_UnderlyingType>(_rho.subspan(_begin, _end - _begin), _theta.subspan(_begin, _end - _begin),
+										_out.subspan(_begin, _end - _begin), _acc);
+		},
+		__detail::__transcendental_grain);
+}
+// Batch Power
+template <typename _UnderlyingType, std::integral _Integer>
+void
+pow(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in, _Integer _e,
+	std::span<complex<_UnderlyingType>> _out)
+{
+	assert(_out.size() >= _in.size());
+	__HYPERCOMPLEX_COUNT(pow, _in.size());
+	__detail::__pow_integer(_in.data(), _out.data(), _in.size(), _e);
+}
+template <typename _UnderlyingType>
+void
+pow(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in, std::type_identity_t<_UnderlyingType> _x,
+	std::span<complex<_UnderlyingType>> _out, accuracy _acc)
+{
+	assert(_out.size() >= _in.size());
+	__HYPERCOMPLEX_COUNT(pow, _in.size());
+	// Same cut-over to binary exponentiation as the scalar pow()
+	if (std::abs(_x) <= _UnderlyingType(1 << 20) && std::trunc(_x) == _x)
+	{
+		__detail::__pow_integer(_in.data(), _out.data(), _in.size(), static_cast<long long>(_x));
+		return;
+	}
+	switch (_acc)
+	{
+	case accuracy::fast:
+		__detail::__pow_real<accuracy::fast>(_in.data(), _x, _out.data(), _in.size());
+		break;
+	case accuracy::balanced:
+		__detail::__pow_real<accuracy::balanced>(_in.data(), _x, _out.data(), _in.size());
+		break;
+	case accuracy::precise:
+		__detail::__pow_real<accuracy::precise>(_in.data(), _x, _out.data(), _in.size());
+		break;
+	}
+}
+template <typename _UnderlyingType>
+void
+pow(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in,
+	const complex<std::type_identity_t<_UnderlyingType>> &_w, std::span<complex<_UnderlyingType>> _out, accuracy _acc)
+{
+	assert(_out.size() >= _in.size());
+	if (_w.imag() == _UnderlyingType(0))
+	{
+		pow<_UnderlyingType>(_in, _w.real(), _out, _acc);
+		return;
+	}
+	__HYPERCOMPLEX_COUNT(pow, _in.size());
+	switch (_acc)
+	{
+	case accuracy::fast:
+		__detail::__pow_complex<accuracy::fast>(_in.data(), _w, _out.data(), _in.size());
+		break;
+	case accuracy::balanced:
+		__detail::__pow_complex<accuracy::balanced>(_in.data(), _w, _out.data(), _in.size());
+		break;
+	case accuracy::precise:
+		__detail::__pow_complex<accuracy::precise>(_in.data(), _w, _out.data(), _in.size());
+		break;
+	}
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType, std::integral _Integer>
+void
+pow(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in, _Integer _e,
+	std::span<complex<_UnderlyingType>> _out)
+{
+	assert(_out.size() >= _in.size());
+	__detail::__for_each_chunk(
+		_policy, _in.size(), [&](std::size_t _begin, std::size_t _end)
+		{ pow<_UnderlyingType>(_in.subspan(_begin, _end - _begin), _e, _out.subspan(_begin, _end - _begin)); },
+		__detail::__transcendental_grain);
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+pow(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in,
+	std::type_identity_t<_UnderlyingType> _x, std::span<complex<_UnderlyingType>> _out,
+	accuracy _acc = accuracy::precise)
+{
+	assert(_out.size() >= _in.size());
+	__detail::__for_each_chunk(
+		_policy, _in.size(), [&](std::size_t _begin, std::size_t _end)
+		{ pow<_UnderlyingType>(_in.subspan(_begin, _end - _begin), _x, _out.subspan(_begin, _end - _begin), _acc); },
+		__detail::__transcendental_grain);
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+pow(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in,
+	const complex<std::type_identity_t<_UnderlyingType>> &_w, std::span<complex<_UnderlyingType>> _out,
+	accuracy _acc = accuracy::precise)
+{
+	assert(_out.size() >= _in.size());
+	__detail::__for_each_chunk(
+		_policy, _in.size(), [&](std::size_t _begin, std::size_t _end)
+		{ pow<_UnderlyingType>(_in.subspan(_begin, _end - _begin), _w, _out.subspan(_begin, _end - _begin), _acc); },
+		__detail::__transcendental_grain);
+}
+
+// Explicit Instantiations
+// The sequential kernels for float, double and long double, see
+// __HYPERCOMPLEX_INSTANTIATE_COMPLEX in complex.hpp
+#define __HYPERCOMPLEX_INSTANTIATE_BATCH(_Extern, _Tp)                                                              \
+	_Extern template void to_polar<_Tp>(std::span<const complex<_Tp>>, std::span<_Tp>, std::span<_Tp>, accuracy);   \
+	_Extern template void from_polar<_Tp>(std::span<const _Tp>, std::span<const _Tp>, std::span<complex<_Tp>>,      \
+										  accuracy);                                                                \
+	_Extern template void add<_Tp>(std::span<const complex<_Tp>>, std::span<const complex<_Tp>>,                    \
+								   std::span<complex<_Tp>>);                                                        \
+	_Extern template void subtract<_Tp>(std::span<const complex<_Tp>>, std::span<const complex<_Tp>>,               \
+										std::span<complex<_Tp>>);                                                   \
+	_Extern template void multiply<_Tp>(std::span<const complex<_Tp>>, std::span<const complex<_Tp>>,               \
+										std::span<complex<_Tp>>);                                                   \
+	_Extern template void divide<_Tp>(std::span<const complex<_Tp>>, std::span<const complex<_Tp>>,                 \
+									  std::span<complex<_Tp>>);                                                     \
+	_Extern template void pow<_Tp, int>(std::span<const complex<_Tp>>, int, std::span<complex<_Tp>>);               \
+	_Extern template void pow<_Tp>(std::span<const complex<_Tp>>, _Tp, std::span<complex<_Tp>>, accuracy);          \
+	_Extern template void pow<_Tp>(std::span<const complex<_Tp>>, const complex<_Tp> &, std::span<complex<_Tp>>,    \
+								   accuracy);
+
+#ifdef HYPERCOMPLEX_EXTERN_TEMPLATES
+__HYPERCOMPLEX_INSTANTIATE_BATCH(extern, float)
+__HYPERCOMPLEX_INSTANTIATE_BATCH(extern, double)
+__HYPERCOMPLEX_INSTANTIATE_BATCH(extern, long double)
+#endif
+} // namespace hypercomplex
+#endif // BATCH_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : batch.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,294 @@
+// header-begin ------------------------------------------
+// File       : cayley_dickson.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Hypercomplex numbers of any power of two dimension
+//      built by the Cayley-Dickson construction: a number of
+//      dimension N is a pair (p, q) of numbers of dimension
+//      N/2 with
+//          (p, q)(r, s) = (pr - s*q, sp + qr*)
+//      where * is conjugation. The product is expanded by
+//      template recursion, so every dimension gets a fully
+//      static kernel. With this convention dimension 4
+//      matches the quaternion Hamilton product.
+//
+// header-end --------------------------------------------
+
+#ifndef CAYLEY_DICKSON_HPP
+#define CAYLEY_DICKSON_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+// The recursive product is only fully unrolled if every level is inlined,
+// which the compilers' size heuristics refuse from dimension 16 on.
+#if defined(_MSC_VER)
+#define __HYPERCOMPLEX_ALWAYS_INLINE __forceinline
+#elif defined(__GNUC__) || defined(__clang__)
+#define __HYPERCOMPLEX_ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define __HYPERCOMPLEX_ALWAYS_INLINE inline
+#endif
+
+namespace hypercomplex
+{
+// Class Forward Decleration
+template <typename _UnderlyingType, std::size_t _Dimension> class cayley_dickson;
+
+namespace __detail
+{
+// _out = conj(_a)
+template <std::size_t _Dimension, typename _UnderlyingType>
+constexpr __HYPERCOMPLEX_ALWAYS_INLINE void
+__cd_conj(const _UnderlyingType *_a, _UnderlyingType *_out)
+{
+	_out[0] = _a[0];
+	for (std::size_t _i = 1; _i < _Dimension; ++_i)
+	{
+		_out[_i] = -_a[_i];
+	}
+}
+
+// _out = _a * _b; _out must not overlap either operand
+template <std::size_t _Dimension, typename _UnderlyingType>
+constexpr __HYPERCOMPLEX_ALWAYS_INLINE void
+__cd_multiply(const _UnderlyingType *_a, const _UnderlyingType *_b, _UnderlyingType *_out)
+{
+	if constexpr (_Dimension == 1)
+	{
+		_out[0] = _a[0] * _b[0];
+	}
+	else
+	{
+		constexpr std::size_t _half = _Dimension / 2;
+		const _UnderlyingType *_p = _a, *_q = _a + _half, *_r = _b, *_s = _b + _half;
+		_UnderlyingType _conj[_half], _t0[_half], _t1[_half];
+
+		// pr - s*q
+		__cd_conj<_half>(_s, _conj);
+		__cd_multiply<_half>(_p, _r, _t0);
+		__cd_multiply<_half>(_conj, _q, _t1);
+		for (std::size_t _i = 0; _i < _half; ++_i)
+		{
+			_out[_i] = _t0[_i] - _t1[_i];
+		}
+		// sp + qr*
+		__cd_conj<_half>(_r, _conj);
+		__cd_multiply<_half>(_s, _p, _t0);
+		__cd_multiply<_half>(_q, _conj, _t1);
+		for (std::size_t _i = 0; _i < _half; ++_i)
+		{
+			_out[_half + _i] = _t0[_i] + _t1[_i];
+		}
+	}
+}
+} // namespace __detail
+
+template <typename _UnderlyingType, std::size_t _Dimension> class cayley_dickson
+{
+	static_assert(std::is_floating_point<_UnderlyingType>::value, "_UnderlyingType must be a floating-point type");
+	static_assert(_Dimension >= 2 && (_Dimension & (_Dimension - 1)) == 0, "_Dimension must be a power of two");
+
+  private:
+	// _c[0] is the real part
+	std::array<_UnderlyingType, _Dimension> _c;
+
+  public:
+	static constexpr std::size_t dimension = _Dimension;
+
+	constexpr cayley_dickson(const _UnderlyingType &_r = _UnderlyingType()) : _c{}
+	{
+		_c[0] = _r;
+	}
+	constexpr cayley_dickson(const std::array<_UnderlyingType, _Dimension> &_components) : _c(_components)
+	{
+	}
+	constexpr cayley_dickson(const cayley_dickson &) = default;
+
+	inline constexpr _UnderlyingType
+	real() const
+	{
+		return _c[0];
+	}
+	inline constexpr _UnderlyingType &
+	operator[](std::size_t _i)
+	{
+		return _c[_i];
+	}
+	inline constexpr const _UnderlyingType &
+	operator[](std::size_t _i) const
+	{
+		return _c[_i];
+	}
+	inline constexpr _UnderlyingType *
+	data()
+	{
+		return _c.data();
+	}
+	inline constexpr const _UnderlyingType *
+	data() const
+	{
+		return _c.data();
+	}
+
+	constexpr cayley_dickson &operator=(const cayley_dickson &rhs) = default;
+	inline constexpr cayley_dickson &
+	operator+=(const cayley_dickson &rhs)
+	{
+		for (std::size_t _i = 0; _i < _Dimension; ++_i)
+		{
+			_c[_i] += rhs._c[_i];
+		}
+		return *this;
+	}
+	inline constexpr cayley_dickson &
+	operator-=(const cayley_dickson &rhs)
+	{
+		for (std::size_t _i = 0; _i < _Dimension; ++_i)
+		{
+			_c[_i] -= rhs._c[_i];
+		}
+		return *this;
+	}
+	inline constexpr cayley_dickson &
+	operator*=(const cayley_dickson &rhs)
+	{
+		const std::array<_UnderlyingType, _Dimension> _lhs = _c;
+		__detail::__cd_multiply<_Dimension>(_lhs.data(), rhs._c.data(), _c.data());
+		return *this;
+	}
+	inline constexpr cayley_dickson &
+	operator*=(const _UnderlyingType &rhs)
+	{
+		for (std::size_t _i = 0; _i < _Dimension; ++_i)
+		{
+			_c[_i] *= rhs;
+		}
+		return *this;
+	}
+	inline constexpr cayley_dickson &
+	operator/=(const _UnderlyingType &rhs)
+	{
+		for (std::size_t _i = 0; _i < _Dimension; ++_i)
+		{
+			_c[_i] /= rhs;
+		}
+		return *this;
+	}
+};
+
+// Arithmetic Operators
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr cayley_dickson<_UnderlyingType, _Dimension>
+operator+(const cayley_dickson<_UnderlyingType, _Dimension> &lhs, const cayley_dickson<_UnderlyingType, _Dimension> &rhs)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r = lhs;
+	return _r += rhs;
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr cayley_dickson<_UnderlyingType, _Dimension>
+operator-(const cayley_dickson<_UnderlyingType, _Dimension> &lhs, const cayley_dickson<_UnderlyingType, _Dimension> &rhs)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r = lhs;
+	return _r -= rhs;
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr cayley_dickson<_UnderlyingType, _Dimension>
+operator*(const cayley_dickson<_UnderlyingType, _Dimension> &lhs, const cayley_dickson<_UnderlyingType, _Dimension> &rhs)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r;
+	__detail::__cd_multiply<_Dimension>(lhs.data(), rhs.data(), _r.data());
+	return _r;
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr cayley_dickson<_UnderlyingType, _Dimension>
+operator*(const cayley_dickson<_UnderlyingType, _Dimension> &lhs, const _UnderlyingType &rhs)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r = lhs;
+	return _r *= rhs;
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr cayley_dickson<_UnderlyingType, _Dimension>
+operator*(const _UnderlyingType &lhs, const cayley_dickson<_UnderlyingType, _Dimension> &rhs)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r = rhs;
+	return _r *= lhs;
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr cayley_dickson<_UnderlyingType, _Dimension>
+operator/(const cayley_dickson<_UnderlyingType, _Dimension> &lhs, const _UnderlyingType &rhs)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r = lhs;
+	return _r /= rhs;
+}
+
+// Equality Operators
+template <typename _UnderlyingType, std::size_t _Dimension>
+inline constexpr bool
+operator==(const cayley_dickson<_UnderlyingType, _Dimension> &lhs, const cayley_dickson<_UnderlyingType, _Dimension> &rhs)
+{
+	for (std::size_t _i = 0; _i < _Dimension; ++_i)
+	{
+		if (lhs[_i] != rhs[_i])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+// Streaming Operators
+template <class _UnderlyingType, std::size_t _Dimension, class charT, class traits>
+std::basic_ostream<charT, traits> &
+operator<<(std::basic_ostream<charT, traits> &o, const cayley_dickson<_UnderlyingType, _Dimension> &rhs)
+{
+	o << "(" << rhs[0];
+	for (std::size_t _i = 1; _i < _Dimension; ++_i)
+	{
+		o << "," << rhs[_i];
+	}
+	o << ")";
+	return o;
+}
+
+// Mathematical Functions
+template <typename _UnderlyingType, std::size_t _Dimension>
+constexpr _UnderlyingType
+norm(const cayley_dickson<_UnderlyingType, _Dimension> &_z)
+{
+	_UnderlyingType _n = 0;
+	for (std::size_t _i = 0; _i < _Dimension; ++_i)
+	{
+		_n += _z[_i] * _z[_i];
+	}
+	return _n;
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+_UnderlyingType
+abs(const cayley_dickson<_UnderlyingType, _Dimension> &_z)
+{
+	return std::sqrt(norm(_z));
+}
+template <typename _UnderlyingType, std::size_t _Dimension>
+constexpr cayley_dickson<_UnderlyingType, _Dimension>
+conj(const cayley_dickson<_UnderlyingType, _Dimension> &_z)
+{
+	cayley_dickson<_UnderlyingType, _Dimension> _r;
+	__detail::__cd_conj<_Dimension>(_z.data(), _r.data());
+	return _r;
+}
+} // namespace hypercomplex
+#endif // CAYLEY_DICKSON_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : cayley_dickson.hpp
+// footer-end --------------------------------------------
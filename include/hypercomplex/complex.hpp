@@ -16,6 +16,9 @@
 #ifndef COMPLEX_HPP
 #define COMPLEX_HPP
 
+#include "counters.hpp"
+
+#include <bit>
 #include <cmath>
 #include <iostream>
 #include <istream>
@@ -28,6 +31,7 @@ namespace hypercomplex
 // Constants
 constexpr long double __pi = 3.1415926535897932384626433832795028L;
 constexpr long double __pi_2 = 1.5707963267948966192313216916397514L;
+constexpr long double __ln10 = 2.3025850929940456840179914546843642L;
 
 // Class Forward Decleration
 template <typename _UnderlyingType> class complex;
@@ -179,18 +183,21 @@ template <typename _UnderlyingType> class complex
 	inline constexpr complex &
 	operator+=(const _UnderlyingType &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(add);
 		_real += rhs;
 		return *this;
 	}
 	inline constexpr complex &
 	operator-=(const _UnderlyingType &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(subtract);
 		_real -= rhs;
 		return *this;
 	}
 	inline constexpr complex &
 	operator*=(const _UnderlyingType &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(scalar_multiply);
 		_real *= rhs;
 		_imag *= rhs;
 		return *this;
@@ -198,6 +205,7 @@ template <typename _UnderlyingType> class complex
 	inline constexpr complex &
 	operator/=(const _UnderlyingType &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(scalar_divide);
 		_real /= rhs;
 		_imag /= rhs;
 		return *this;
@@ -216,6 +224,7 @@ template <typename _UnderlyingType> class complex
 	inline constexpr complex &
 	operator+=(const complex<_Type> &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(add);
 		_real += rhs.real();
 		_imag += rhs.imag();
 		return *this;
@@ -224,6 +233,7 @@ template <typename _UnderlyingType> class complex
 	inline constexpr complex &
 	operator-=(const complex<_Type> &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(subtract);
 		_real -= rhs.real();
 		_imag -= rhs.imag();
 		return *this;
@@ -232,6 +242,7 @@ template <typename _UnderlyingType> class complex
 	inline constexpr complex &
 	operator*=(const complex<_Type> &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(multiply);
 		_imag = _real * rhs.imag() + _imag * rhs.real();
 		_real = _real * rhs.real() - _imag * rhs.imag();
 		return *this;
@@ -242,6 +253,7 @@ template <typename _UnderlyingType> class complex
 	inline constexpr complex &
 	operator/=(const complex<_Type> &rhs)
 	{
+		__HYPERCOMPLEX_COUNT(divide);
 		const _UnderlyingType _r = _real * rhs.real() + _imag * rhs.imag();
 		const _UnderlyingType _norm = norm(rhs);
 		_imag = (_imag * rhs.real() - _real * rhs.imag()) / _norm;
@@ -250,6 +262,13 @@ template <typename _UnderlyingType> class complex
 	}
 };
 
+// complex<T> must stay layout compatible with T[2]: the FFT and the
+// interleave kernels address spans of it as 2n scalars
+static_assert(std::is_standard_layout_v<complex<float>> && sizeof(complex<float>) == 2 * sizeof(float));
+static_assert(std::is_standard_layout_v<complex<double>> && sizeof(complex<double>) == 2 * sizeof(double));
+static_assert(std::is_standard_layout_v<complex<long double>> &&
+			  sizeof(complex<long double>) == 2 * sizeof(long double));
+
 inline namespace literals
 {
 inline namespace complex_literals
@@ -312,18 +331,21 @@ template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator+(const complex<_UnderlyingType> &lhs, const complex<_UnderlyingType> &rhs)
 {
+	__HYPERCOMPLEX_COUNT(add);
 	return complex(lhs.real() + rhs.real(), lhs.imag() + rhs.imag());
 }
 template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator+(const complex<_UnderlyingType> &lhs, const _UnderlyingType &rhs)
 {
+	__HYPERCOMPLEX_COUNT(add);
 	return complex(lhs.real() + rhs, lhs.imag());
 }
 template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator+(const _UnderlyingType &lhs, const complex<_UnderlyingType> &rhs)
 {
+	__HYPERCOMPLEX_COUNT(add);
 	return complex(lhs + rhs.real(), rhs.imag());
 }
 
@@ -332,18 +354,21 @@ template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator-(const complex<_UnderlyingType> &lhs, const complex<_UnderlyingType> &rhs)
 {
+	__HYPERCOMPLEX_COUNT(subtract);
 	return complex(lhs.real() - rhs.real(), lhs.imag() - rhs.imag());
 }
 template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator-(const complex<_UnderlyingType> &lhs, const _UnderlyingType &rhs)
 {
+	__HYPERCOMPLEX_COUNT(subtract);
 	return complex(lhs.real() - rhs, lhs.imag());
 }
 template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator-(const _UnderlyingType &lhs, const complex<_UnderlyingType> &rhs)
 {
+	__HYPERCOMPLEX_COUNT(subtract);
 	return complex(lhs - rhs.real(), -rhs.imag());
 }
 
@@ -352,6 +377,7 @@ template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator*(const complex<_UnderlyingType> &lhs, const complex<_UnderlyingType> &rhs)
 {
+	__HYPERCOMPLEX_COUNT(multiply);
 	_UnderlyingType _r = lhs.real() * rhs.real() - lhs.imag() * rhs.imag();
 	_UnderlyingType _i = lhs.real() * rhs.imag() + lhs.imag() * rhs.real();
 	complex<_UnderlyingType> _t(_r, _i);
@@ -361,6 +387,7 @@ template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator*(const complex<_UnderlyingType> &lhs, const _UnderlyingType &rhs)
 {
+	__HYPERCOMPLEX_COUNT(scalar_multiply);
 	_UnderlyingType _r = lhs.real() * rhs;
 	_UnderlyingType _i = lhs.imag() * rhs;
 	complex<_UnderlyingType> _t(_r, _i);
@@ -370,6 +397,7 @@ template <typename _UnderlyingType>
 inline constexpr complex<_UnderlyingType>
 operator*(const _UnderlyingType &lhs, const complex<_UnderlyingType> &rhs)
 {
+	__HYPERCOMPLEX_COUNT(scalar_multiply);
 	_UnderlyingType _r = lhs * rhs.real();
 	_UnderlyingType _i = lhs * rhs.imag();
 	complex<_UnderlyingType> _t(_r, _i);
@@ -462,14 +490,14 @@ template <typename _UnderlyingType>
 _UnderlyingType
 abs(const complex<_UnderlyingType> &_z)
 {
-	_UnderlyingType _r = _z.real();
-	_UnderlyingType _i = _z.imag();
-	return std::sqrt(_r * _r + _i * _i);
+	__HYPERCOMPLEX_COUNT(abs);
+	return std::hypot(_z.real(), _z.imag());
 }
 template <typename _UnderlyingType>
 _UnderlyingType
 arg(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(arg);
 	return std::atan2(_z.imag(), _z.real());
 }
 template <typename _UnderlyingType>
@@ -495,6 +523,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 polar(const _UnderlyingType &_rho, const _UnderlyingType &_theta)
 {
+	__HYPERCOMPLEX_COUNT(polar);
 	if (!std::isinf(_theta) && !std::isnan(_theta) && !std::isnan(_rho))
 	{
 		if (std::isinf(_rho))
@@ -524,6 +553,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 cos(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(trigonometric);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	_UnderlyingType _real = std::cos(_a) * std::cosh(_b);
 	_UnderlyingType _imag = -1.0f * std::sin(_a) * std::sinh(_b);
@@ -539,6 +569,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 sin(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(trigonometric);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	_UnderlyingType _r = std::sin(_a) * std::cosh(_b);
 	_UnderlyingType _i = std::cos(_a) * std::sinh(_b);
@@ -554,6 +585,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 tan(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(trigonometric);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	complex<_UnderlyingType> _numerator = std::tan(_a) + 1.0if * std::tanh(_b);
 	complex<_UnderlyingType> _denomerator = 1.0f - 1.0if * std::tan(_a) * std::tanh(_b);
@@ -570,6 +602,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 cot(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(trigonometric);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	complex<_UnderlyingType> _numerator
 		= 1.0f + 1.0if * (std::cos(_a) / std::sin(_a)) * (std::cosh(_b) / std::sinh(_b));
@@ -586,6 +619,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 cosh(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(hyperbolic);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	_UnderlyingType _r = std::cosh(_a) * std::cos(_b);
 	_UnderlyingType _i = std::sinh(_a) * std::sin(_b);
@@ -601,6 +635,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 sinh(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(hyperbolic);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	_UnderlyingType _r = std::sinh(_a) * std::cos(_b);
 	_UnderlyingType _i = std::cosh(_a) * std::sin(_b);
@@ -616,6 +651,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 tanh(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(hyperbolic);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	_UnderlyingType _numerator = std::sinh(_a) * std::cos(_b) + 1.0if * std::cosh(_a) * std::sin(_b);
 	_UnderlyingType _denominator = std::cosh(_a) * std::cos(_b) + 1.0if * std::sinh(_a) * std::sin(_b);
@@ -631,6 +667,7 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 coth(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(hyperbolic);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 	_UnderlyingType _numerator = std::cosh(_a) * std::cos(_b) + 1.0if * std::sinh(_a) * std::sin(_b);
 	_UnderlyingType _denominator = std::sinh(_a) * std::cos(_b) + 1.0if * std::cosh(_a) * std::sin(_b);
@@ -646,34 +683,186 @@ template <typename _UnderlyingType>
 complex<_UnderlyingType>
 exp(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(exp);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
+	const _UnderlyingType _e = std::exp(_a);
+	// A zero imaginary part stays zero even when exp(a) is infinite
+	const _UnderlyingType _i = _b == _UnderlyingType(0) ? _b : _e * std::sin(_b);
+	return complex<_UnderlyingType>(_e * std::cos(_b), _i);
 }
 template <typename _UnderlyingType>
 complex<_UnderlyingType>
 log(const complex<_UnderlyingType> &_z)
 {
+	__HYPERCOMPLEX_COUNT(log);
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
+	return complex<_UnderlyingType>(std::log(std::hypot(_a, _b)), std::atan2(_b, _a));
 }
 template <typename _UnderlyingType>
 complex<_UnderlyingType>
 log10(const complex<_UnderlyingType> &_z)
 {
-	_UnderlyingType _a = _z.real(), _b = _z.imag();
+	constexpr _UnderlyingType _inv_ln10 = static_cast<_UnderlyingType>(1.0L / __ln10);
+	const complex<_UnderlyingType> _l = log(_z);
+	return complex<_UnderlyingType>(_l.real() * _inv_ln10, _l.imag() * _inv_ln10);
+}
+
+// z^n by left-to-right binary exponentiation: one squaring per bit of n
+// and one extra multiply per set bit, no log/exp.
+template <typename _UnderlyingType>
+constexpr complex<_UnderlyingType>
+__pow_unsigned(const complex<_UnderlyingType> &_z, unsigned long long _n)
+{
+	if (_n == 0)
+	{
+		return complex<_UnderlyingType>(1);
+	}
+	const _UnderlyingType _zr = _z.real(), _zi = _z.imag();
+	_UnderlyingType _r = _zr, _i = _zi;
+	for (unsigned long long _bit = std::bit_floor(_n) >> 1; _bit != 0; _bit >>= 1)
+	{
+		const _UnderlyingType _sr = _r * _r - _i * _i;
+		_i = (_r + _r) * _i;
+		_r = _sr;
+		if (_n & _bit)
+		{
+			const _UnderlyingType _mr = _r * _zr - _i * _zi;
+			_i = _r * _zi + _i * _zr;
+			_r = _mr;
+		}
+	}
+	return complex<_UnderlyingType>(_r, _i);
+}
+// 1 / z by Smith's method: the larger part of z divides the smaller, so
+// nothing is squared and the result overflows or underflows only when
+// 1 / |z| itself is out of range
+template <typename _UnderlyingType>
+constexpr complex<_UnderlyingType>
+__reciprocal(const complex<_UnderlyingType> &_z)
+{
+	const _UnderlyingType _a = _z.real(), _b = _z.imag();
+	const bool _real_larger = (_a < 0 ? -_a : _a) >= (_b < 0 ? -_b : _b);
+	const _UnderlyingType _p = _real_larger ? _a : _b, _q = _real_larger ? _b : _a;
+	const _UnderlyingType _ratio = _q / _p;
+	const _UnderlyingType _d = _p + _q * _ratio;
+	return complex<_UnderlyingType>(_real_larger ? _UnderlyingType(1) / _d : _ratio / _d,
+									_real_larger ? -_ratio / _d : _UnderlyingType(-1) / _d);
+}
+
+template <typename _UnderlyingType, typename _Integer>
+constexpr complex<_UnderlyingType>
+__pow_integer(const complex<_UnderlyingType> &_z, _Integer _n)
+{
+	if constexpr (std::is_signed_v<_Integer>)
+	{
+		// Negate in the unsigned type so that the minimum value is safe
+		const unsigned long long _m = static_cast<unsigned long long>(_n);
+		if (_n < 0)
+		{
+			// z^-n = (1 / z)^n; inverting z^n instead would square |z|^n
+			return __pow_unsigned(__reciprocal(_z), 0ull - _m);
+		}
+		return __pow_unsigned(_z, _m);
+	}
+	else
+	{
+		return __pow_unsigned(_z, static_cast<unsigned long long>(_n));
+	}
+}
+
+template <typename _UnderlyingType>
+complex<_UnderlyingType>
+__pow_real(const complex<_UnderlyingType> &_z, _UnderlyingType _x)
+{
+	if (std::abs(_x) <= _UnderlyingType(1 << 20) && std::trunc(_x) == _x)
+	{
+		return __pow_integer(_z, static_cast<long long>(_x));
+	}
+	// Zero sin/cos terms stay zero when |z|^x is infinite, as in polar()
+	const _UnderlyingType _m = std::pow(std::hypot(_z.real(), _z.imag()), _x);
+	const _UnderlyingType _t = _x * std::atan2(_z.imag(), _z.real());
+	const _UnderlyingType _c = std::cos(_t), _s = std::sin(_t);
+	return complex<_UnderlyingType>(_c == _UnderlyingType(0) ? _c : _m * _c, _s == _UnderlyingType(0) ? _s : _m * _s);
+}
+
+// 0^w for a complex exponent w = c + di: 1 for w = 0, 0 for c > 0 and
+// an infinite modulus for c < 0, real for d = 0 and of undefined phase
+// (inf, NaN) otherwise. For c = 0, d != 0 (or a NaN w) the result is
+// (NaN, NaN).
+template <typename _UnderlyingType>
+complex<_UnderlyingType>
+__pow_zero(const complex<_UnderlyingType> &_w)
+{
+	constexpr _UnderlyingType _inf = std::numeric_limits<_UnderlyingType>::infinity();
+	constexpr _UnderlyingType _nan = std::numeric_limits<_UnderlyingType>::quiet_NaN();
+	const _UnderlyingType _c = _w.real(), _d = _w.imag();
+	if (_c == _UnderlyingType(0) && _d == _UnderlyingType(0))
+	{
+		return complex<_UnderlyingType>(1);
+	}
+	if (_c > _UnderlyingType(0) && !std::isnan(_d))
+	{
+		return complex<_UnderlyingType>();
+	}
+	if (_c < _UnderlyingType(0) && !std::isnan(_d))
+	{
+		return complex<_UnderlyingType>(_inf, _d == _UnderlyingType(0) ? _UnderlyingType(0) : _nan);
+	}
+	return complex<_UnderlyingType>(_nan, _nan);
 }
+
+// Integer exponents, and real exponents with an integral value up to
+// 2^20, use binary exponentiation. Other real exponents go through the
+// polar form |z|^x * (cos x*arg z, i sin x*arg z); complex exponents
+// through exp(w * log z).
 template <typename _UnderlyingType, typename _ExponentialType>
 complex<_UnderlyingType>
 pow(const complex<_UnderlyingType> &_z, const _ExponentialType &exp)
 {
+	__HYPERCOMPLEX_COUNT(pow);
+	if constexpr (std::is_integral_v<_ExponentialType>)
+	{
+		return __pow_integer(_z, exp);
+	}
+	else
+	{
+		return __pow_real(_z, static_cast<_UnderlyingType>(exp));
+	}
 }
 template <typename _UnderlyingType, typename _BaseType>
 complex<_UnderlyingType>
-pow(const _BaseType &, const complex<_UnderlyingType> &)
+pow(const _BaseType &_x, const complex<_UnderlyingType> &_w)
 {
+	__HYPERCOMPLEX_COUNT(pow);
+	const _UnderlyingType _b = static_cast<_UnderlyingType>(_x);
+	if (_b > _UnderlyingType(0))
+	{
+		// x^w = x^c * (cos d ln x, i sin d ln x) for a positive real base
+		const _UnderlyingType _m = std::pow(_b, _w.real());
+		const _UnderlyingType _t = _w.imag() * std::log(_b);
+		const _UnderlyingType _i = _t == _UnderlyingType(0) ? _t : _m * std::sin(_t);
+		return complex<_UnderlyingType>(_m * std::cos(_t), _i);
+	}
+	if (_b == _UnderlyingType(0))
+	{
+		return __pow_zero(_w);
+	}
+	return hypercomplex::exp(_w * log(complex<_UnderlyingType>(_b)));
 }
 template <typename _UnderlyingType>
 complex<_UnderlyingType>
-pow(const complex<_UnderlyingType> &, const complex<_UnderlyingType> &)
+pow(const complex<_UnderlyingType> &_z, const complex<_UnderlyingType> &_w)
 {
+	__HYPERCOMPLEX_COUNT(pow);
+	if (_z.real() == _UnderlyingType(0) && _z.imag() == _UnderlyingType(0))
+	{
+		return __pow_zero(_w);
+	}
+	if (_w.imag() == _UnderlyingType(0))
+	{
+		return __pow_real(_z, _w.real());
+	}
+	return hypercomplex::exp(_w * log(_z));
 }
 template <typename _UnderlyingType>
 complex<_UnderlyingType>
@@ -681,6 +870,38 @@ sqrt(const complex<_UnderlyingType> &_z)
 {
 	_UnderlyingType _a = _z.real(), _b = _z.imag();
 }
+
+// Explicit Instantiations
+// The hypercomplex library target (src/hypercomplex.cpp) instantiates
+// the implemented functions for float, double and long double (tan,
+// cot, tanh and coth are left out until they compile for every type). Code
+// built with HYPERCOMPLEX_EXTERN_TEMPLATES, as everything linking that
+// target is, uses those instead of instantiating them again in every
+// translation unit. _Extern is either extern or empty.
+#define __HYPERCOMPLEX_INSTANTIATE_COMPLEX(_Extern, _Tp)                                                            \
+	_Extern template class complex<_Tp>;                                                                            \
+	_Extern template std::ostream &operator<< <_Tp, char, std::char_traits<char>>(std::ostream &,                   \
+																				   const complex<_Tp> &);           \
+	_Extern template _Tp abs(const complex<_Tp> &);                                                                 \
+	_Extern template _Tp arg(const complex<_Tp> &);                                                                 \
+	_Extern template complex<_Tp> polar(const _Tp &, const _Tp &);                                                  \
+	_Extern template complex<_Tp> cos(const complex<_Tp> &);                                                        \
+	_Extern template complex<_Tp> sin(const complex<_Tp> &);                                                        \
+	_Extern template complex<_Tp> cosh(const complex<_Tp> &);                                                       \
+	_Extern template complex<_Tp> sinh(const complex<_Tp> &);                                                       \
+	_Extern template complex<_Tp> exp(const complex<_Tp> &);                                                        \
+	_Extern template complex<_Tp> log(const complex<_Tp> &);                                                        \
+	_Extern template complex<_Tp> log10(const complex<_Tp> &);                                                      \
+	_Extern template complex<_Tp> pow<_Tp, int>(const complex<_Tp> &, const int &);                                 \
+	_Extern template complex<_Tp> pow<_Tp, _Tp>(const complex<_Tp> &, const _Tp &);                                 \
+	_Extern template complex<_Tp> pow<_Tp, _Tp>(const _Tp &, const complex<_Tp> &);                                \
+	_Extern template complex<_Tp> pow(const complex<_Tp> &, const complex<_Tp> &);
+
+#ifdef HYPERCOMPLEX_EXTERN_TEMPLATES
+__HYPERCOMPLEX_INSTANTIATE_COMPLEX(extern, float)
+__HYPERCOMPLEX_INSTANTIATE_COMPLEX(extern, double)
+__HYPERCOMPLEX_INSTANTIATE_COMPLEX(extern, long double)
+#endif
 } // namespace hypercomplex
 #endif // COMPLEX_HPP
 
@@ -0,0 +1,341 @@
+// header-begin ------------------------------------------
+// File       : counters.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Opt-in operation counters. Compiling with
+//      HYPERCOMPLEX_ENABLE_COUNTERS defined makes the
+//      operators and functions of complex.hpp (and the
+//      batch kernels) count their calls in thread-local
+//      counters. Without it every counting site expands to
+//      nothing and the query functions return zeros.
+//
+// header-end --------------------------------------------
+
+#ifndef COUNTERS_HPP
+#define COUNTERS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(HYPERCOMPLEX_ENABLE_COUNTERS)
+#include <atomic>
+#include <mutex>
+#endif
+
+namespace hypercomplex
+{
+namespace counters
+{
+#if defined(HYPERCOMPLEX_ENABLE_COUNTERS)
+inline constexpr bool enabled = true;
+#else
+inline constexpr bool enabled = false;
+#endif
+
+// Counted operations, complex operands unless marked scalar
+enum class op : std::size_t
+{
+	add,
+	subtract,
+	multiply,
+	divide,
+	scalar_multiply,
+	scalar_divide,
+	abs,
+	arg,
+	polar,
+	exp,
+	log,
+	pow,
+	sqrt,
+	trigonometric,
+	hyperbolic,
+	count
+};
+
+inline constexpr std::size_t op_count = static_cast<std::size_t>(op::count);
+
+inline constexpr const char *op_names[op_count]
+	= {"add", "subtract", "multiply", "divide", "scalar_multiply", "scalar_divide", "abs", "arg",
+	   "polar", "exp", "log", "pow", "sqrt", "trigonometric", "hyperbolic"};
+
+// Estimated real floating point operations per call. Libm calls
+// (sin, exp, atan2, ...) are charged 20 flops each, so these are
+// meant for comparing stages, not for absolute roofline numbers.
+inline constexpr std::uint64_t flops_per_op[op_count] = {
+	2,	 // add
+	2,	 // subtract
+	6,	 // multiply
+	11,	 // divide
+	2,	 // scalar_multiply
+	2,	 // scalar_divide
+	22,	 // abs: hypot
+	20,	 // arg: atan2
+	42,	 // polar: sin, cos and two multiplies
+	42,	 // exp: exp, sin, cos and two multiplies
+	42,	 // log: log of hypot and atan2
+	100, // pow: log, multiply and exp
+	60,	 // sqrt
+	86,	 // trigonometric: four libm calls and a few flops
+	86	 // hyperbolic
+};
+
+struct snapshot
+{
+	std::array<std::uint64_t, op_count> counts{};
+
+	inline std::uint64_t
+	operator[](op _op) const noexcept
+	{
+		return counts[static_cast<std::size_t>(_op)];
+	}
+	inline std::uint64_t
+	flops() const noexcept
+	{
+		std::uint64_t _total = 0;
+		for (std::size_t _i = 0; _i < op_count; ++_i)
+		{
+			_total += counts[_i] * flops_per_op[_i];
+		}
+		return _total;
+	}
+	inline snapshot &
+	operator+=(const snapshot &_rhs) noexcept
+	{
+		for (std::size_t _i = 0; _i < op_count; ++_i)
+		{
+			counts[_i] += _rhs.counts[_i];
+		}
+		return *this;
+	}
+	// Counts accumulated between two snapshots of the same thread(s)
+	inline snapshot
+	operator-(const snapshot &_rhs) const noexcept
+	{
+		snapshot _r;
+		for (std::size_t _i = 0; _i < op_count; ++_i)
+		{
+			_r.counts[_i] = counts[_i] - _rhs.counts[_i];
+		}
+		return _r;
+	}
+};
+
+#if defined(HYPERCOMPLEX_ENABLE_COUNTERS)
+namespace __detail
+{
+// One per thread. Only the owning thread writes; other threads read the
+// counters when aggregating, hence relaxed atomics.
+struct __block
+{
+	std::thread::id _id = std::this_thread::get_id();
+	std::array<std::atomic<std::uint64_t>, op_count> _counts{};
+
+	__block();
+	~__block();
+};
+
+struct __registry
+{
+	std::mutex _mutex;
+	std::vector<__block *> _live;
+	snapshot _retired;
+};
+
+inline __registry &
+__get_registry()
+{
+	static __registry _r;
+	return _r;
+}
+
+inline __block::__block()
+{
+	__registry &_r = __get_registry();
+	std::lock_guard<std::mutex> _lock(_r._mutex);
+	_r._live.push_back(this);
+}
+inline __block::~__block()
+{
+	// Fold the counts of an exiting thread into the process totals
+	__registry &_r = __get_registry();
+	std::lock_guard<std::mutex> _lock(_r._mutex);
+	for (std::size_t _i = 0; _i < op_count; ++_i)
+	{
+		_r._retired.counts[_i] += _counts[_i].load(std::memory_order_relaxed);
+	}
+	std::erase(_r._live, this);
+}
+
+inline __block &
+__this_block()
+{
+	thread_local __block _b;
+	return _b;
+}
+
+inline snapshot
+__read(const __block &_b)
+{
+	snapshot _s;
+	for (std::size_t _i = 0; _i < op_count; ++_i)
+	{
+		_s.counts[_i] = _b._counts[_i].load(std::memory_order_relaxed);
+	}
+	return _s;
+}
+} // namespace __detail
+
+// Not noexcept: the first count on a thread registers its block, which
+// allocates
+inline void
+__record(op _op, std::uint64_t _n = 1)
+{
+	auto &_c = __detail::__this_block()._counts[static_cast<std::size_t>(_op)];
+	_c.store(_c.load(std::memory_order_relaxed) + _n, std::memory_order_relaxed);
+}
+
+// Counts of the calling thread
+inline snapshot
+this_thread()
+{
+	return __detail::__read(__detail::__this_block());
+}
+
+// Counts of every live thread, one entry per thread that has counted
+inline std::vector<std::pair<std::thread::id, snapshot>>
+per_thread()
+{
+	__detail::__registry &_r = __detail::__get_registry();
+	std::lock_guard<std::mutex> _lock(_r._mutex);
+	std::vector<std::pair<std::thread::id, snapshot>> _out;
+	for (const __detail::__block *_b : _r._live)
+	{
+		_out.emplace_back(_b->_id, __detail::__read(*_b));
+	}
+	return _out;
+}
+
+// Sum over live threads and threads that have already exited
+inline snapshot
+total()
+{
+	__detail::__registry &_r = __detail::__get_registry();
+	std::lock_guard<std::mutex> _lock(_r._mutex);
+	snapshot _s = _r._retired;
+	for (const __detail::__block *_b : _r._live)
+	{
+		_s += __detail::__read(*_b);
+	}
+	return _s;
+}
+
+// Zeroes the counters of every thread. Counts made concurrently with a
+// reset may survive it.
+inline void
+reset()
+{
+	__detail::__registry &_r = __detail::__get_registry();
+	std::lock_guard<std::mutex> _lock(_r._mutex);
+	_r._retired = snapshot{};
+	for (__detail::__block *_b : _r._live)
+	{
+		for (auto &_c : _b->_counts)
+		{
+			_c.store(0, std::memory_order_relaxed);
+		}
+	}
+}
+#else
+inline constexpr void
+__record(op, std::uint64_t = 1) noexcept
+{
+}
+inline snapshot
+this_thread()
+{
+	return snapshot{};
+}
+inline std::vector<std::pair<std::thread::id, snapshot>>
+per_thread()
+{
+	return {};
+}
+inline snapshot
+total()
+{
+	return snapshot{};
+}
+inline void
+reset()
+{
+}
+#endif
+
+// Writes one "name count flops" line per non-zero counter
+template <class charT, class traits>
+std::basic_ostream<charT, traits> &
+dump(std::basic_ostream<charT, traits> &o, const snapshot &_s)
+{
+	for (std::size_t _i = 0; _i < op_count; ++_i)
+	{
+		if (_s.counts[_i] != 0)
+		{
+			o << op_names[_i] << " " << _s.counts[_i] << " " << _s.counts[_i] * flops_per_op[_i] << "\n";
+		}
+	}
+	o << "total_flops " << _s.flops() << "\n";
+	return o;
+}
+
+// Per thread counts followed by the aggregate
+template <class charT, class traits>
+std::basic_ostream<charT, traits> &
+dump(std::basic_ostream<charT, traits> &o)
+{
+	for (const auto &[_id, _s] : per_thread())
+	{
+		o << "[thread " << _id << "]\n";
+		dump(o, _s);
+	}
+	o << "[total]\n";
+	return dump(o, total());
+}
+} // namespace counters
+} // namespace hypercomplex
+
+// Counting site used by the library. Skipped during constant evaluation
+// so the constexpr operators stay usable in constant expressions.
+#if defined(HYPERCOMPLEX_ENABLE_COUNTERS)
+#define __HYPERCOMPLEX_COUNT(_op, ...)                                                                                   \
+	do                                                                                                                 \
+	{                                                                                                                  \
+		if (!std::is_constant_evaluated())                                                                             \
+		{                                                                                                              \
+			::hypercomplex::counters::__record(::hypercomplex::counters::op::_op __VA_OPT__(, ) __VA_ARGS__);          \
+		}                                                                                                              \
+	} while (false)
+#else
+#define __HYPERCOMPLEX_COUNT(_op, ...)                                                                                   \
+	do                                                                                                                 \
+	{                                                                                                                  \
+	} while (false)
+#endif
+
+#endif // COUNTERS_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : counters.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,440 @@
+// header-begin ------------------------------------------
+// File       : escape.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Escape-time iteration of complex maps over a grid of
+//      points (Mandelbrot, Julia and Newton fractals). The
+//      grid is cut into square tiles that the thread pool
+//      steals from each other; inside a tile a row is
+//      iterated a group of lanes at a time with branch-free
+//      lane updates, so the compiler vectorizes across
+//      lanes. A lane that escapes is frozen and the group
+//      stops as soon as every lane is done.
+//
+//      Deep Mandelbrot zooms, where neighbouring pixels are
+//      no longer distinct in _UnderlyingType, use
+//      perturbation: one reference orbit is computed in long
+//      double at the grid center and each pixel iterates
+//      only its small offset from it, rebasing onto the
+//      start of the orbit when the offset stops being small.
+//
+// header-end --------------------------------------------
+
+#ifndef ESCAPE_HPP
+#define ESCAPE_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+#include <vector>
+
+namespace hypercomplex
+{
+enum class escape_map
+{
+	// z <- z^2 + c, z0 = 0, c = pixel
+	mandelbrot,
+	// z <- z^2 + c, z0 = pixel, c = escape_options::julia_c
+	julia,
+	// Newton's method for z^3 - 1, z0 = pixel
+	newton
+};
+
+// width x height pixels of pixel_size centred on center; row 0 is the
+// top (largest imaginary part)
+template <typename _UnderlyingType> struct escape_grid
+{
+	complex<_UnderlyingType> center;
+	_UnderlyingType pixel_size;
+	std::size_t width, height;
+
+	// Offset of pixel (row, col) from the center, exact as long as the
+	// pixel size is
+	inline constexpr complex<_UnderlyingType>
+	offset(std::size_t _row, std::size_t _col) const
+	{
+		return complex<_UnderlyingType>(
+			(static_cast<_UnderlyingType>(_col) - static_cast<_UnderlyingType>(width - 1) / 2) * pixel_size,
+			(static_cast<_UnderlyingType>(height - 1) / 2 - static_cast<_UnderlyingType>(_row)) * pixel_size);
+	}
+	inline constexpr complex<_UnderlyingType>
+	at(std::size_t _row, std::size_t _col) const
+	{
+		const complex<_UnderlyingType> _d = offset(_row, _col);
+		return complex<_UnderlyingType>(center.real() + _d.real(), center.imag() + _d.imag());
+	}
+};
+
+template <typename _UnderlyingType> struct escape_options
+{
+	escape_map map = escape_map::mandelbrot;
+	std::uint32_t max_iterations = 1000;
+	// Escape radius. Smooth coloring is smoother with a large one (256).
+	_UnderlyingType bailout = 2;
+	// Distance to a root at which Newton iteration counts as converged
+	_UnderlyingType tolerance = _UnderlyingType(1e-6);
+	complex<_UnderlyingType> julia_c{};
+	// Main cardioid and period-2 bulb test (Mandelbrot) and periodicity
+	// detection, which end interior points early. Not applied with
+	// perturbation.
+	bool interior_checks = true;
+	// Mandelbrot only; the other maps ignore it
+	bool perturbation = false;
+	std::size_t tile = 64;
+};
+
+namespace __detail
+{
+constexpr std::size_t __escape_lanes = 16;
+
+// Inside the main cardioid or the period-2 bulb of the Mandelbrot set
+template <typename _UnderlyingType>
+inline bool
+__in_main_bulbs(_UnderlyingType _x, _UnderlyingType _y)
+{
+	const _UnderlyingType _xq = _x - _UnderlyingType(0.25);
+	const _UnderlyingType _q = _xq * _xq + _y * _y;
+	const _UnderlyingType _xb = _x + _UnderlyingType(1);
+	return _q * (_q + _xq) <= _UnderlyingType(0.25) * _y * _y || _xb * _xb + _y * _y <= _UnderlyingType(0.0625);
+}
+
+// Writes a finished group. _last is |z|^2 at escape, or the squared
+// distance to the root for Newton.
+template <escape_map _Map, typename _UnderlyingType, typename _Out>
+inline void
+__escape_store(const _UnderlyingType *_n, const _UnderlyingType *_last, std::size_t _count, _UnderlyingType _max,
+			   _UnderlyingType _tolerance2, _Out *_out)
+{
+	for (std::size_t _l = 0; _l < _count; ++_l)
+	{
+		if constexpr (std::is_integral_v<_Out>)
+		{
+			_out[_l] = static_cast<_Out>(_n[_l]);
+		}
+		else if (_n[_l] >= _max)
+		{
+			_out[_l] = static_cast<_Out>(_max);
+		}
+		else if constexpr (_Map == escape_map::newton)
+		{
+			// Quadratic convergence: the log distance doubles per step
+			const _UnderlyingType _d2 = std::max(_last[_l], std::numeric_limits<_UnderlyingType>::min());
+			_out[_l] = static_cast<_Out>(_n[_l] - std::log2(std::log(_d2) / std::log(_tolerance2)));
+		}
+		else
+		{
+			_out[_l] = static_cast<_Out>(_n[_l] + 1 - std::log2(_UnderlyingType(0.5) * std::log(_last[_l])));
+		}
+	}
+}
+
+// Iterates pixels [_col, _col + _count) of _row, _count <= __escape_lanes
+template <escape_map _Map, bool _Checks, typename _UnderlyingType, typename _Out>
+void
+__escape_group(const escape_grid<_UnderlyingType> &_grid, const escape_options<_UnderlyingType> &_opts,
+			   std::size_t _row, std::size_t _col, std::size_t _count, _Out *_out)
+{
+	using _Tp = _UnderlyingType;
+	constexpr std::size_t _W = __escape_lanes;
+	_Tp _zr[_W], _zi[_W], _cr[_W], _ci[_W], _n[_W], _last[_W], _live[_W], _pr[_W], _pi[_W];
+
+	const _Tp _max = static_cast<_Tp>(_opts.max_iterations);
+	for (std::size_t _l = 0; _l < _W; ++_l)
+	{
+		// Spare lanes repeat the last pixel
+		const complex<_Tp> _p = _grid.at(_row, _col + std::min(_l, _count - 1));
+		if constexpr (_Map == escape_map::mandelbrot)
+		{
+			_zr[_l] = _Tp(0);
+			_zi[_l] = _Tp(0);
+			_cr[_l] = _p.real();
+			_ci[_l] = _p.imag();
+		}
+		else
+		{
+			_zr[_l] = _p.real();
+			_zi[_l] = _p.imag();
+			_cr[_l] = _opts.julia_c.real();
+			_ci[_l] = _opts.julia_c.imag();
+		}
+		_n[_l] = _max;
+		_last[_l] = _Tp(0);
+		_live[_l] = _Tp(1);
+		if constexpr (_Checks && _Map == escape_map::mandelbrot)
+		{
+			_live[_l] = __in_main_bulbs(_p.real(), _p.imag()) ? _Tp(0) : _Tp(1);
+		}
+		_pr[_l] = _zr[_l];
+		_pi[_l] = _zi[_l];
+	}
+
+	const _Tp _bail2 = _opts.bailout * _opts.bailout;
+	const _Tp _tol2 = _opts.tolerance * _opts.tolerance;
+	const _Tp _period2 = _Tp(16) * std::numeric_limits<_Tp>::epsilon() * std::numeric_limits<_Tp>::epsilon();
+	const _Tp _root_i = std::numbers::sqrt3_v<_Tp> / 2;
+	for (std::uint32_t _it = 0; _it < _opts.max_iterations; ++_it)
+	{
+		const _Tp _itf = static_cast<_Tp>(_it);
+		_Tp _any = 0;
+		for (std::size_t _l = 0; _l < _W; ++_l)
+		{
+			const _Tp _x = _zr[_l], _y = _zi[_l];
+			const _Tp _x2 = _x * _x, _y2 = _y * _y;
+			_Tp _nx, _ny, _measure;
+			bool _done;
+			if constexpr (_Map == escape_map::newton)
+			{
+				// Squared distance to the nearest cube root of unity
+				const _Tp _dx1 = _x - _Tp(1);
+				const _Tp _dxr = _x + _Tp(0.5), _dyp = _y - _root_i, _dym = _y + _root_i;
+				_measure = std::min(std::min(_dx1 * _dx1 + _y2, _dxr * _dxr + _dyp * _dyp), _dxr * _dxr + _dym * _dym);
+				_done = _measure < _tol2;
+				// z <- (2 z^3 + 1) / (3 z^2)
+				const _Tp _sr = _x2 - _y2, _si = (_x + _x) * _y;
+				const _Tp _ar = _Tp(2) * (_sr * _x - _si * _y) + _Tp(1), _ai = _Tp(2) * (_sr * _y + _si * _x);
+				const _Tp _br = _Tp(3) * _sr, _bi = _Tp(3) * _si;
+				const _Tp _inv = _Tp(1) / (_br * _br + _bi * _bi);
+				_nx = (_ar * _br + _ai * _bi) * _inv;
+				_ny = (_ai * _br - _ar * _bi) * _inv;
+			}
+			else
+			{
+				_measure = _x2 + _y2;
+				_done = _measure > _bail2;
+				_nx = _x2 - _y2 + _cr[_l];
+				_ny = (_x + _x) * _y + _ci[_l];
+			}
+			const bool _was_live = _live[_l] != _Tp(0);
+			_n[_l] = _was_live & _done ? _itf : _n[_l];
+			_last[_l] = _was_live & _done ? _measure : _last[_l];
+			bool _alive = _was_live & !_done;
+			_zr[_l] = _alive ? _nx : _x;
+			_zi[_l] = _alive ? _ny : _y;
+			if constexpr (_Checks)
+			{
+				// Back on a point seen before: a cycle, never escapes
+				const _Tp _dr = _nx - _pr[_l], _di = _ny - _pi[_l];
+				_alive = _alive & !(_dr * _dr + _di * _di < _period2);
+			}
+			_live[_l] = _alive ? _Tp(1) : _Tp(0);
+			_any += _live[_l];
+		}
+		if constexpr (_Checks)
+		{
+			// Brent: compare against the value at the last power of two
+			if (((_it + 1) & _it) == 0)
+			{
+				std::copy_n(_zr, _W, _pr);
+				std::copy_n(_zi, _W, _pi);
+			}
+		}
+		if (_any == _Tp(0))
+		{
+			break;
+		}
+	}
+	__escape_store<_Map>(_n, _last, _count, _max, _tol2, _out);
+}
+
+// Reference orbit Z_0 = 0, Z_{k+1} = Z_k^2 + C for the grid center,
+// computed in long double, up to escape or max_iterations
+template <typename _UnderlyingType>
+void
+__reference_orbit(const escape_grid<_UnderlyingType> &_grid, const escape_options<_UnderlyingType> &_opts,
+				  std::vector<_UnderlyingType> &_re, std::vector<_UnderlyingType> &_im)
+{
+	const long double _cr = _grid.center.real(), _ci = _grid.center.imag();
+	const long double _bail2 = static_cast<long double>(_opts.bailout) * _opts.bailout;
+	long double _x = 0, _y = 0;
+	_re.assign(1, _UnderlyingType(0));
+	_im.assign(1, _UnderlyingType(0));
+	for (std::uint32_t _it = 0; _it < _opts.max_iterations && _x * _x + _y * _y <= _bail2; ++_it)
+	{
+		const long double _nx = _x * _x - _y * _y + _cr;
+		_y = 2 * _x * _y + _ci;
+		_x = _nx;
+		_re.push_back(static_cast<_UnderlyingType>(_x));
+		_im.push_back(static_cast<_UnderlyingType>(_y));
+	}
+}
+
+// Mandelbrot by perturbation: z = Z_m + d, d <- (2 Z_m + d) d + dc. When
+// |z| < |d|, or the reference ends, d is rebased to z with m = 0.
+template <typename _UnderlyingType, typename _Out>
+void
+__escape_group_perturbed(const escape_grid<_UnderlyingType> &_grid, const escape_options<_UnderlyingType> &_opts,
+						 const _UnderlyingType *_ref_re, const _UnderlyingType *_ref_im, std::size_t _ref_last,
+						 std::size_t _row, std::size_t _col, std::size_t _count, _Out *_out)
+{
+	using _Tp = _UnderlyingType;
+	constexpr std::size_t _W = __escape_lanes;
+	_Tp _dr[_W], _di[_W], _dcr[_W], _dci[_W], _n[_W], _last[_W], _live[_W];
+	std::size_t _m[_W];
+
+	const _Tp _max = static_cast<_Tp>(_opts.max_iterations);
+	for (std::size_t _l = 0; _l < _W; ++_l)
+	{
+		const complex<_Tp> _dc = _grid.offset(_row, _col + std::min(_l, _count - 1));
+		_dr[_l] = _Tp(0);
+		_di[_l] = _Tp(0);
+		_dcr[_l] = _dc.real();
+		_dci[_l] = _dc.imag();
+		_n[_l] = _max;
+		_last[_l] = _Tp(0);
+		_live[_l] = _Tp(1);
+		_m[_l] = 0;
+	}
+
+	const _Tp _bail2 = _opts.bailout * _opts.bailout;
+	for (std::uint32_t _it = 0; _it < _opts.max_iterations; ++_it)
+	{
+		const _Tp _itf = static_cast<_Tp>(_it);
+		_Tp _any = 0;
+		for (std::size_t _l = 0; _l < _W; ++_l)
+		{
+			const _Tp _Zr = _ref_re[_m[_l]], _Zi = _ref_im[_m[_l]];
+			const _Tp _x = _Zr + _dr[_l], _y = _Zi + _di[_l];
+			const _Tp _mag2 = _x * _x + _y * _y;
+			const bool _was_live = _live[_l] != _Tp(0);
+			const bool _done = _mag2 > _bail2;
+			_n[_l] = _was_live & _done ? _itf : _n[_l];
+			_last[_l] = _was_live & _done ? _mag2 : _last[_l];
+			const bool _alive = _was_live & !_done;
+
+			const bool _rebase = _mag2 < _dr[_l] * _dr[_l] + _di[_l] * _di[_l] || _m[_l] == _ref_last;
+			const _Tp _br = _rebase ? _x : _dr[_l], _bi = _rebase ? _y : _di[_l];
+			const _Tp _zr = _rebase ? _Tp(0) : _Zr, _zi = _rebase ? _Tp(0) : _Zi;
+			const _Tp _tr = _zr + _zr + _br, _ti = _zi + _zi + _bi;
+			const _Tp _nr = _tr * _br - _ti * _bi + _dcr[_l];
+			const _Tp _ni = _tr * _bi + _ti * _br + _dci[_l];
+			_dr[_l] = _alive ? _nr : _dr[_l];
+			_di[_l] = _alive ? _ni : _di[_l];
+			_m[_l] = _alive ? (_rebase ? 1 : _m[_l] + 1) : _m[_l];
+			_live[_l] = _alive ? _Tp(1) : _Tp(0);
+			_any += _live[_l];
+		}
+		if (_any == _Tp(0))
+		{
+			break;
+		}
+	}
+	__escape_store<escape_map::mandelbrot>(_n, _last, _count, _max, _Tp(0), _out);
+}
+
+template <escape_map _Map, bool _Checks, typename _Policy, typename _UnderlyingType, typename _Out, typename _Alloc>
+void
+__escape_tiles(const _Policy &_policy, const escape_grid<_UnderlyingType> &_grid,
+			   const escape_options<_UnderlyingType> &_opts, matrix<_Out, _Alloc> &_out)
+{
+	const std::size_t _tile = std::max<std::size_t>(_opts.tile, 1);
+	const std::size_t _tiles_x = (_grid.width + _tile - 1) / _tile;
+	const std::size_t _tiles_y = (_grid.height + _tile - 1) / _tile;
+
+	std::vector<_UnderlyingType> _ref_re, _ref_im;
+	const bool _perturbed = _Map == escape_map::mandelbrot && _opts.perturbation;
+	if (_perturbed)
+	{
+		__reference_orbit(_grid, _opts, _ref_re, _ref_im);
+	}
+
+	__for_each_chunk(
+		_policy, _tiles_x * _tiles_y,
+		[&](std::size_t _begin, std::size_t _end)
+		{
+			for (std::size_t _t = _begin; _t < _end; ++_t)
+			{
+				const std::size_t _r0 = _t / _tiles_x * _tile, _c0 = _t % _tiles_x * _tile;
+				const std::size_t _r1 = std::min(_r0 + _tile, _grid.height);
+				const std::size_t _c1 = std::min(_c0 + _tile, _grid.width);
+				for (std::size_t _r = _r0; _r < _r1; ++_r)
+				{
+					for (std::size_t _c = _c0; _c < _c1; _c += __escape_lanes)
+					{
+						const std::size_t _count = std::min(__escape_lanes, _c1 - _c);
+						if (_perturbed)
+						{
+							__escape_group_perturbed(_grid, _opts, _ref_re.data(), _ref_im.data(), _ref_re.size() - 1,
+													 _r, _c, _count, &_out(_r, _c));
+						}
+						else
+						{
+							__escape_group<_Map, _Checks>(_grid, _opts, _r, _c, _count, &_out(_r, _c));
+						}
+					}
+				}
+			}
+		},
+		1);
+}
+} // namespace __detail
+
+// Fills _out (resized to height x width) with, per pixel, the iteration
+// at which the orbit escaped (Newton: converged), or max_iterations if it
+// never did. An integral _Out receives the count, a floating point one
+// the smooth (continuous) iteration count.
+template <execution::execution_policy _Policy, typename _UnderlyingType, typename _Out, typename _Alloc>
+void
+escape_time(const _Policy &_policy, const escape_grid<_UnderlyingType> &_grid,
+			const escape_options<_UnderlyingType> &_opts, matrix<_Out, _Alloc> &_out)
+{
+	static_assert(std::is_arithmetic_v<_Out>, "_Out must be an integral or floating-point type");
+	_out.resize(_grid.height, _grid.width);
+	if (_grid.width == 0 || _grid.height == 0)
+	{
+		return;
+	}
+	switch (_opts.map)
+	{
+	case escape_map::mandelbrot:
+		if (_opts.interior_checks && !_opts.perturbation)
+		{
+			__detail::__escape_tiles<escape_map::mandelbrot, true>(_policy, _grid, _opts, _out);
+		}
+		else
+		{
+			__detail::__escape_tiles<escape_map::mandelbrot, false>(_policy, _grid, _opts, _out);
+		}
+		break;
+	case escape_map::julia:
+		if (_opts.interior_checks)
+		{
+			__detail::__escape_tiles<escape_map::julia, true>(_policy, _grid, _opts, _out);
+		}
+		else
+		{
+			__detail::__escape_tiles<escape_map::julia, false>(_policy, _grid, _opts, _out);
+		}
+		break;
+	case escape_map::newton:
+		// Every orbit converges or wanders; there is no cycle to detect
+		__detail::__escape_tiles<escape_map::newton, false>(_policy, _grid, _opts, _out);
+		break;
+	}
+}
+template <typename _UnderlyingType, typename _Out, typename _Alloc>
+void
+escape_time(const escape_grid<_UnderlyingType> &_grid, const escape_options<_UnderlyingType> &_opts,
+			matrix<_Out, _Alloc> &_out)
+{
+	escape_time(execution::seq, _grid, _opts, _out);
+}
+} // namespace hypercomplex
+#endif // ESCAPE_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : escape.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,451 @@
+// header-begin ------------------------------------------
+// File       : execution.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Execution policies for the batch kernels and the
+//      work-stealing thread pool behind the parallel ones.
+//      Every parallel algorithm in the library runs on a
+//      thread_pool, by default the process wide
+//      default_pool(), so there is only ever one set of
+//      worker threads.
+//
+//      On a machine with several NUMA nodes the pool can pin
+//      its workers to nodes and hand each of them a fixed
+//      contiguous part of every range (thread_placement::numa),
+//      so that memory first touched through the pool, as
+//      numa::array does, is local to the thread that later
+//      works on it. default_pool() does so whenever more than
+//      one node is found.
+//
+// header-end --------------------------------------------
+
+#ifndef EXECUTION_HPP
+#define EXECUTION_HPP
+
+#include "numa.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace hypercomplex
+{
+// Class Forward Decleration
+class thread_pool;
+thread_pool &default_pool();
+
+namespace execution
+{
+// Run on the calling thread
+struct sequenced_policy
+{
+};
+// Split across the threads of _pool (default_pool() when null)
+struct parallel_policy
+{
+	thread_pool *_pool = nullptr;
+
+	constexpr parallel_policy
+	on(thread_pool &_p) const noexcept
+	{
+		return parallel_policy{&_p};
+	}
+};
+// As parallel_policy; each chunk is additionally free to vectorize,
+// which the batch kernels already do.
+struct parallel_unsequenced_policy
+{
+	thread_pool *_pool = nullptr;
+
+	constexpr parallel_unsequenced_policy
+	on(thread_pool &_p) const noexcept
+	{
+		return parallel_unsequenced_policy{&_p};
+	}
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+template <typename _Tp>
+inline constexpr bool is_execution_policy_v
+	= std::is_same_v<std::remove_cvref_t<_Tp>, sequenced_policy>
+	  || std::is_same_v<std::remove_cvref_t<_Tp>, parallel_policy>
+	  || std::is_same_v<std::remove_cvref_t<_Tp>, parallel_unsequenced_policy>;
+
+template <typename _Tp>
+concept execution_policy = is_execution_policy_v<_Tp>;
+} // namespace execution
+
+// Smallest number of elements worth handing to another thread for a
+// kernel that does a few flops per element. Transcendental kernels pass
+// a smaller grain.
+constexpr std::size_t __default_grain = 16384;
+
+// How a thread_pool places its workers. unpinned leaves them to the
+// scheduler and spreads chunks round robin; numa pins worker q to node
+// q * nodes / size() and queues chunk c of a range on worker
+// c * size() / chunks, whoever the caller is, so that the same part of
+// equally sized ranges always lands on the same node. Workers then
+// steal from the queues of their own node first and from other nodes
+// only once those are empty.
+enum class thread_placement
+{
+	unpinned,
+	numa
+};
+
+// Fixed set of workers, each owning a deque of range tasks. A worker
+// pops from the back of its own deque and steals from the front of the
+// others. The thread calling parallel_for queues the chunks and then
+// executes tasks itself until its range is done, so nested calls from
+// inside a task cannot deadlock. Under thread_placement::numa a caller
+// from outside the pool only runs tasks queued on node 0, for which it
+// stands in.
+class thread_pool
+{
+  private:
+	struct __task
+	{
+		void (*_run)(void *, std::size_t, std::size_t);
+		void *_ctx;
+		std::size_t _begin, _end;
+		std::atomic<std::size_t> *_remaining;
+		std::exception_ptr *_error;
+		std::mutex *_error_mutex;
+	};
+	struct alignas(64) __queue
+	{
+		std::mutex _mutex;
+		std::deque<__task> _tasks;
+	};
+
+	std::vector<std::unique_ptr<__queue>> _queues;
+	std::vector<std::thread> _workers;
+	std::atomic<std::size_t> _queued{0};
+	std::atomic<std::size_t> _next{0};
+	thread_placement _placement = thread_placement::unpinned;
+	std::mutex _sleep_mutex;
+	std::condition_variable _sleep;
+	bool _stop = false;
+
+	// Queue owned by the current thread when it is one of our workers
+	static constexpr std::size_t __npos = static_cast<std::size_t>(-1);
+	struct __identity
+	{
+		const thread_pool *_pool = nullptr;
+		std::size_t _index = __npos;
+	};
+	static __identity &
+	__current()
+	{
+		thread_local __identity _id;
+		return _id;
+	}
+	inline std::size_t
+	__home() const
+	{
+		const __identity &_id = __current();
+		return _id._pool == this ? _id._index : __npos;
+	}
+
+	void
+	__push(std::size_t _q, const __task &_t)
+	{
+		_queued.fetch_add(1, std::memory_order_release);
+		std::lock_guard<std::mutex> _lock(_queues[_q]->_mutex);
+		_queues[_q]->_tasks.push_back(_t);
+	}
+	// Takes a task from queue _home, else steals one. Under
+	// thread_placement::numa the queues of _home's node are tried before
+	// all others, and the others not at all unless _remote.
+	bool
+	__pop(std::size_t _home, __task &_t, bool _remote = true)
+	{
+		const std::size_t _n = _queues.size();
+		const bool _local_first = _placement == thread_placement::numa;
+		const std::size_t _node = node_of(_home);
+		const int _passes = _local_first && _remote ? 2 : 1;
+		for (int _pass = 0; _pass < _passes; ++_pass)
+		{
+			for (std::size_t _k = 0; _k < _n; ++_k)
+			{
+				const std::size_t _q = (_home + _k) % _n;
+				if (_local_first && (node_of(_q) == _node) != (_pass == 0))
+				{
+					continue;
+				}
+				std::lock_guard<std::mutex> _lock(_queues[_q]->_mutex);
+				auto &_tasks = _queues[_q]->_tasks;
+				if (_tasks.empty())
+				{
+					continue;
+				}
+				if (_k == 0)
+				{
+					_t = _tasks.back();
+					_tasks.pop_back();
+				}
+				else
+				{
+					_t = _tasks.front();
+					_tasks.pop_front();
+				}
+				_queued.fetch_sub(1, std::memory_order_relaxed);
+				return true;
+			}
+		}
+		return false;
+	}
+	static void
+	__execute(const __task &_t)
+	{
+		try
+		{
+			_t._run(_t._ctx, _t._begin, _t._end);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> _lock(*_t._error_mutex);
+			if (!*_t._error)
+			{
+				*_t._error = std::current_exception();
+			}
+		}
+		_t._remaining->fetch_sub(1, std::memory_order_acq_rel);
+	}
+	void
+	__worker(std::size_t _index)
+	{
+		__current() = __identity{this, _index};
+		if (_placement == thread_placement::numa)
+		{
+			numa_topology::system().pin_current_thread(node_of(_index));
+		}
+		__task _t;
+		for (;;)
+		{
+			if (__pop(_index, _t))
+			{
+				__execute(_t);
+				continue;
+			}
+			std::unique_lock<std::mutex> _lock(_sleep_mutex);
+			_sleep.wait(_lock, [this] { return _stop || _queued.load(std::memory_order_acquire) != 0; });
+			if (_stop)
+			{
+				return;
+			}
+		}
+	}
+
+  public:
+	// _threads is the total parallelism including the calling thread,
+	// so thread_pool(1) runs everything inline. The calling thread is
+	// never pinned; with thread_placement::numa it stands in for a
+	// worker of node 0.
+	explicit thread_pool(std::size_t _threads = std::max(1u, std::thread::hardware_concurrency()),
+						 thread_placement _where = thread_placement::unpinned)
+		: _placement(_where)
+	{
+		_threads = std::max<std::size_t>(_threads, 1);
+		for (std::size_t _i = 0; _i < _threads; ++_i)
+		{
+			_queues.push_back(std::make_unique<__queue>());
+		}
+		for (std::size_t _i = 1; _i < _threads; ++_i)
+		{
+			_workers.emplace_back([this, _i] { __worker(_i); });
+		}
+	}
+	thread_pool(const thread_pool &) = delete;
+	thread_pool &operator=(const thread_pool &) = delete;
+	~thread_pool()
+	{
+		{
+			std::lock_guard<std::mutex> _lock(_sleep_mutex);
+			_stop = true;
+		}
+		_sleep.notify_all();
+		for (auto &_w : _workers)
+		{
+			_w.join();
+		}
+	}
+
+	inline std::size_t
+	size() const noexcept
+	{
+		return _queues.size();
+	}
+	inline thread_placement
+	placement() const noexcept
+	{
+		return _placement;
+	}
+	// NUMA node (an index into numa_topology::system()) that worker _q
+	// is pinned to under thread_placement::numa
+	inline std::size_t
+	node_of(std::size_t _q) const noexcept
+	{
+		return _q * numa_topology::system().nodes() / size();
+	}
+
+	// Number of chunks parallel_for splits _n elements into: one when
+	// the range is below _grain, otherwise up to four per thread so
+	// that stealing can even out imbalance.
+	inline std::size_t
+	chunks(std::size_t _n, std::size_t _grain) const noexcept
+	{
+		_grain = std::max<std::size_t>(_grain, 1);
+		if (_n <= _grain || size() == 1)
+		{
+			return 1;
+		}
+		return std::min((_n + _grain - 1) / _grain, 4 * size());
+	}
+
+	// Calls _fn(begin, end) over disjoint sub-ranges covering
+	// [_begin, _end) and returns once all of them have run. The first
+	// exception thrown by _fn is rethrown here.
+	template <typename _Function>
+	void
+	parallel_for(std::size_t _begin, std::size_t _end, _Function &&_fn, std::size_t _grain = __default_grain)
+	{
+		if (_end <= _begin)
+		{
+			return;
+		}
+		const std::size_t _n = _end - _begin;
+		const std::size_t _count = chunks(_n, _grain);
+		if (_count == 1)
+		{
+			_fn(_begin, _end);
+			return;
+		}
+
+		using _Fn = std::remove_reference_t<_Function>;
+		std::atomic<std::size_t> _remaining{_count};
+		std::exception_ptr _error;
+		std::mutex _error_mutex;
+		auto _run = [](void *_ctx, std::size_t _b, std::size_t _e) { (*static_cast<_Fn *>(_ctx))(_b, _e); };
+
+		const std::size_t _home = __home();
+		const bool _blocked = _placement == thread_placement::numa;
+		const std::size_t _first
+			= _blocked ? 0 : (_home != __npos ? _home : _next.fetch_add(1, std::memory_order_relaxed));
+		for (std::size_t _c = 0; _c < _count; ++_c)
+		{
+			const std::size_t _b = _begin + _n * _c / _count;
+			const std::size_t _e = _begin + _n * (_c + 1) / _count;
+			__push((_first + (_blocked ? _c * size() / _count : _c)) % size(),
+				   __task{_run, const_cast<void *>(static_cast<const void *>(&_fn)), _b, _e, &_remaining, &_error,
+						  &_error_mutex});
+		}
+		{
+			std::lock_guard<std::mutex> _lock(_sleep_mutex);
+		}
+		_sleep.notify_all();
+
+		// An outside caller under numa keeps to node 0, queue 0 being its
+		// own; the pinned workers drain the other nodes
+		__task _t;
+		const std::size_t _steal_from = _home != __npos ? _home : _first % size();
+		const bool _remote = _home != __npos || !_blocked;
+		while (_remaining.load(std::memory_order_acquire) != 0)
+		{
+			if (__pop(_steal_from, _t, _remote))
+			{
+				__execute(_t);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+		if (_error)
+		{
+			std::rethrow_exception(_error);
+		}
+	}
+};
+
+// Process wide pool shared by every parallel algorithm. Its size is
+// taken from the HYPERCOMPLEX_NUM_THREADS environment variable when set,
+// otherwise from std::thread::hardware_concurrency(). Workers are pinned
+// to NUMA nodes when there is more than one, unless
+// HYPERCOMPLEX_PIN_THREADS is set to 0.
+inline thread_pool &
+default_pool()
+{
+	static thread_pool _pool(
+		[]
+		{
+			const char *_env = std::getenv("HYPERCOMPLEX_NUM_THREADS");
+			const long _n = _env != nullptr ? std::atol(_env) : 0;
+			return _n > 0 ? static_cast<std::size_t>(_n) : std::max(1u, std::thread::hardware_concurrency());
+		}(),
+		[]
+		{
+			const char *_env = std::getenv("HYPERCOMPLEX_PIN_THREADS");
+			const bool _allowed = _env == nullptr || std::strcmp(_env, "0") != 0;
+			return _allowed && numa_topology::system().nodes() > 1 ? thread_placement::numa
+																	: thread_placement::unpinned;
+		}());
+	return _pool;
+}
+
+namespace __detail
+{
+template <typename _Policy>
+inline thread_pool &
+__pool_of(const _Policy &_policy)
+{
+	if constexpr (std::is_same_v<std::remove_cvref_t<_Policy>, execution::sequenced_policy>)
+	{
+		return default_pool();
+	}
+	else
+	{
+		return _policy._pool != nullptr ? *_policy._pool : default_pool();
+	}
+}
+
+// Runs _fn(begin, end) over [0, _n) as _policy asks
+template <typename _Policy, typename _Function>
+inline void
+__for_each_chunk(const _Policy &_policy, std::size_t _n, _Function &&_fn, std::size_t _grain = __default_grain)
+{
+	if constexpr (std::is_same_v<std::remove_cvref_t<_Policy>, execution::sequenced_policy>)
+	{
+		_fn(std::size_t(0), _n);
+	}
+	else
+	{
+		__pool_of(_policy).parallel_for(0, _n, std::forward<_Function>(_fn), _grain);
+	}
+}
+} // namespace __detail
+} // namespace hypercomplex
+#endif // EXECUTION_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : execution.hpp
+// footer-end --------------------------------------------
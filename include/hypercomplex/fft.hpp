@@ -0,0 +1,157 @@
+// header-begin ------------------------------------------
+// File       : fft.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Power of two FFT plans. A plan owns the bit reversal
+//      permutation and one contiguous twiddle table per
+//      stage, so the butterfly loops are unit stride and
+//      vectorize. Transforms run in place, either on
+//      interleaved complex data or on split real and
+//      imaginary arrays, and are unnormalized: inverse(
+//      forward(x)) is size() * x.
+//
+// header-end --------------------------------------------
+
+#ifndef FFT_HPP
+#define FFT_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+#include "interleave.hpp"
+
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace hypercomplex
+{
+template <typename _UnderlyingType> class fft_plan
+{
+  private:
+	std::size_t _n = 0;
+	array<std::uint32_t> _reverse;
+	// Stage with half length m uses exp(-i pi j / m), j < m, stored at
+	// offset m - 1
+	array<_UnderlyingType> _twiddle_re, _twiddle_im;
+
+	// _Stride is 2 for interleaved complex data and 1 for split arrays
+	template <bool _Inverse, std::size_t _Stride>
+	void
+	__transform(_UnderlyingType *__restrict _re, _UnderlyingType *__restrict _im) const
+	{
+		for (std::size_t _i = 0; _i < _n; ++_i)
+		{
+			const std::size_t _j = _reverse[_i];
+			if (_i < _j)
+			{
+				std::swap(_re[_i * _Stride], _re[_j * _Stride]);
+				std::swap(_im[_i * _Stride], _im[_j * _Stride]);
+			}
+		}
+		for (std::size_t _m = 1; _m < _n; _m *= 2)
+		{
+			const _UnderlyingType *_wr = _twiddle_re.data() + (_m - 1);
+			const _UnderlyingType *_wi = _twiddle_im.data() + (_m - 1);
+			for (std::size_t _k = 0; _k < _n; _k += 2 * _m)
+			{
+				_UnderlyingType *_ar = _re + _k * _Stride, *_ai = _im + _k * _Stride;
+				_UnderlyingType *_br = _ar + _m * _Stride, *_bi = _ai + _m * _Stride;
+				for (std::size_t _j = 0; _j < _m; ++_j)
+				{
+					const _UnderlyingType _c = _wr[_j];
+					const _UnderlyingType _s = _Inverse ? -_wi[_j] : _wi[_j];
+					const _UnderlyingType _tr = _c * _br[_j * _Stride] - _s * _bi[_j * _Stride];
+					const _UnderlyingType _ti = _c * _bi[_j * _Stride] + _s * _br[_j * _Stride];
+					const _UnderlyingType _xr = _ar[_j * _Stride], _xi = _ai[_j * _Stride];
+					_br[_j * _Stride] = _xr - _tr;
+					_bi[_j * _Stride] = _xi - _ti;
+					_ar[_j * _Stride] = _xr + _tr;
+					_ai[_j * _Stride] = _xi + _ti;
+				}
+			}
+		}
+	}
+
+  public:
+	fft_plan() = default;
+	// Throws std::invalid_argument unless _size is a power of two
+	explicit fft_plan(std::size_t _size) : _n(_size), _reverse(_size), _twiddle_re(_size), _twiddle_im(_size)
+	{
+		if (!std::has_single_bit(_size) || _size > (std::size_t(1) << 31))
+		{
+			throw std::invalid_argument("fft_plan: size must be a power of two");
+		}
+		const int _bits = std::countr_zero(_size);
+		for (std::size_t _i = 0; _i < _size; ++_i)
+		{
+			std::size_t _r = 0;
+			for (int _b = 0; _b < _bits; ++_b)
+			{
+				_r |= ((_i >> _b) & 1) << (_bits - 1 - _b);
+			}
+			_reverse[_i] = static_cast<std::uint32_t>(_r);
+		}
+		for (std::size_t _m = 1; _m < _size; _m *= 2)
+		{
+			for (std::size_t _j = 0; _j < _m; ++_j)
+			{
+				const double _theta = -std::numbers::pi * static_cast<double>(_j) / static_cast<double>(_m);
+				_twiddle_re[_m - 1 + _j] = static_cast<_UnderlyingType>(std::cos(_theta));
+				_twiddle_im[_m - 1 + _j] = static_cast<_UnderlyingType>(std::sin(_theta));
+			}
+		}
+	}
+
+	inline std::size_t
+	size() const noexcept
+	{
+		return _n;
+	}
+
+	// X[k] = sum x[j] exp(-2 pi i j k / n)
+	void
+	forward(std::span<complex<_UnderlyingType>> _data) const
+	{
+		assert(_data.size() == _n);
+		_UnderlyingType *_p = as_scalars(_data).data();
+		__transform<false, 2>(_p, _p + 1);
+	}
+	// x[j] = sum X[k] exp(+2 pi i j k / n), without the 1 / n
+	void
+	inverse(std::span<complex<_UnderlyingType>> _data) const
+	{
+		assert(_data.size() == _n);
+		_UnderlyingType *_p = as_scalars(_data).data();
+		__transform<true, 2>(_p, _p + 1);
+	}
+	void
+	forward(std::span<_UnderlyingType> _re, std::span<_UnderlyingType> _im) const
+	{
+		assert(_re.size() == _n && _im.size() == _n);
+		__transform<false, 1>(_re.data(), _im.data());
+	}
+	void
+	inverse(std::span<_UnderlyingType> _re, std::span<_UnderlyingType> _im) const
+	{
+		assert(_re.size() == _n && _im.size() == _n);
+		__transform<true, 1>(_re.data(), _im.data());
+	}
+};
+} // namespace hypercomplex
+#endif // FFT_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : fft.hpp
+// footer-end --------------------------------------------
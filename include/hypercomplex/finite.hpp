@@ -0,0 +1,215 @@
+// header-begin ------------------------------------------
+// File       : finite.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Finite-only versions of the complex functions, for
+//      callers whose inputs are validated upstream. They
+//      assume every input is finite and that |z|^2 does not
+//      overflow, and drop the special value handling (NaN,
+//      infinities, signed zero corner cases) that the
+//      functions in complex.hpp carry. What is left is
+//      straight-line code: the few remaining choices are
+//      selects, so loops over these functions vectorize
+//      under the same flags as batch.hpp.
+//
+//      Each function takes the accuracy of batch.hpp as an
+//      optional first template argument. precise calls the C
+//      library; fast and balanced use the batch polynomials.
+//      Debug builds assert that the inputs are finite (with
+//      -ffinite-math-only the compiler may fold that check
+//      away).
+//
+// header-end --------------------------------------------
+
+#ifndef FINITE_HPP
+#define FINITE_HPP
+
+#include "batch.hpp"
+#include "complex.hpp"
+#include "counters.hpp"
+
+#include <cassert>
+#include <cmath>
+
+namespace hypercomplex
+{
+namespace finite_math
+{
+namespace __detail
+{
+template <typename _UnderlyingType>
+inline bool
+__is_finite(const complex<_UnderlyingType> &_z)
+{
+	return std::isfinite(_z.real()) && std::isfinite(_z.imag());
+}
+
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__sincos(_UnderlyingType _x, _UnderlyingType &_sin, _UnderlyingType &_cos)
+{
+	if constexpr (_Accuracy == accuracy::precise)
+	{
+		_sin = std::sin(_x);
+		_cos = std::cos(_x);
+	}
+	else
+	{
+		hypercomplex::__detail::__sincos<_Accuracy>(_x, _sin, _cos);
+	}
+}
+
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline _UnderlyingType
+__atan2(_UnderlyingType _y, _UnderlyingType _x)
+{
+	if constexpr (_Accuracy == accuracy::precise)
+	{
+		return std::atan2(_y, _x);
+	}
+	else
+	{
+		return hypercomplex::__detail::__atan2<_Accuracy>(_y, _x);
+	}
+}
+} // namespace __detail
+
+// sqrt(x^2 + y^2), without std::hypot's rescaling
+template <typename _UnderlyingType>
+inline _UnderlyingType
+abs(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::abs: input is not finite");
+	__HYPERCOMPLEX_COUNT(abs);
+	return std::sqrt(norm(_z));
+}
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline _UnderlyingType
+arg(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::arg: input is not finite");
+	__HYPERCOMPLEX_COUNT(arg);
+	return __detail::__atan2<_Accuracy>(_z.imag(), _z.real());
+}
+// rho (cos theta, i sin theta); unlike hypercomplex::polar a negative
+// rho is used as is
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+polar(const _UnderlyingType &_rho, const _UnderlyingType &_theta = 0)
+{
+	assert(std::isfinite(_rho) && std::isfinite(_theta) && "finite_math::polar: input is not finite");
+	__HYPERCOMPLEX_COUNT(polar);
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_theta, _s, _c);
+	return complex<_UnderlyingType>(_rho * _c, _rho * _s);
+}
+
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+exp(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::exp: input is not finite");
+	__HYPERCOMPLEX_COUNT(exp);
+	const _UnderlyingType _e = std::exp(_z.real());
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_z.imag(), _s, _c);
+	return complex<_UnderlyingType>(_e * _c, _e * _s);
+}
+// ln|z| is taken as ln(|z|^2) / 2, saving the square root
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+log(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::log: input is not finite");
+	__HYPERCOMPLEX_COUNT(log);
+	return complex<_UnderlyingType>(_UnderlyingType(0.5) * std::log(norm(_z)),
+									__detail::__atan2<_Accuracy>(_z.imag(), _z.real()));
+}
+// |z|^x (cos x arg z, i sin x arg z) for every real x, with |z|^x taken
+// as (|z|^2)^(x / 2)
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+pow(const complex<_UnderlyingType> &_z, const _UnderlyingType &_x)
+{
+	assert(__detail::__is_finite(_z) && std::isfinite(_x) && "finite_math::pow: input is not finite");
+	__HYPERCOMPLEX_COUNT(pow);
+	const _UnderlyingType _m = std::pow(norm(_z), _UnderlyingType(0.5) * _x);
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_x * __detail::__atan2<_Accuracy>(_z.imag(), _z.real()), _s, _c);
+	return complex<_UnderlyingType>(_m * _c, _m * _s);
+}
+// Principal root: t = sqrt((|z| + |a|) / 2) and b / 2t, placed by the
+// sign of a
+template <typename _UnderlyingType>
+inline complex<_UnderlyingType>
+sqrt(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::sqrt: input is not finite");
+	const _UnderlyingType _a = _z.real(), _b = _z.imag();
+	const _UnderlyingType _t = std::sqrt(_UnderlyingType(0.5) * (std::sqrt(norm(_z)) + std::abs(_a)));
+	const _UnderlyingType _u = _t == _UnderlyingType(0) ? _UnderlyingType(0) : _b / (_t + _t);
+	const _UnderlyingType _r = _a >= _UnderlyingType(0) ? _t : std::abs(_u);
+	const _UnderlyingType _i = _a >= _UnderlyingType(0) ? _u : std::copysign(_t, _b);
+	return complex<_UnderlyingType>(_r, _i);
+}
+
+// The circular and hyperbolic functions take cosh and sinh from a
+// single exp, so sinh of a tiny argument is accurate only in absolute
+// terms
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+sin(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::sin: input is not finite");
+	__HYPERCOMPLEX_COUNT(trigonometric);
+	const _UnderlyingType _e = std::exp(_z.imag()), _ie = _UnderlyingType(1) / _e;
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_z.real(), _s, _c);
+	return complex<_UnderlyingType>(_s * _UnderlyingType(0.5) * (_e + _ie), _c * _UnderlyingType(0.5) * (_e - _ie));
+}
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+cos(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::cos: input is not finite");
+	__HYPERCOMPLEX_COUNT(trigonometric);
+	const _UnderlyingType _e = std::exp(_z.imag()), _ie = _UnderlyingType(1) / _e;
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_z.real(), _s, _c);
+	return complex<_UnderlyingType>(_c * _UnderlyingType(0.5) * (_e + _ie), -_s * _UnderlyingType(0.5) * (_e - _ie));
+}
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+sinh(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::sinh: input is not finite");
+	__HYPERCOMPLEX_COUNT(hyperbolic);
+	const _UnderlyingType _e = std::exp(_z.real()), _ie = _UnderlyingType(1) / _e;
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_z.imag(), _s, _c);
+	return complex<_UnderlyingType>(_c * _UnderlyingType(0.5) * (_e - _ie), _s * _UnderlyingType(0.5) * (_e + _ie));
+}
+template <accuracy _Accuracy = accuracy::precise, typename _UnderlyingType>
+inline complex<_UnderlyingType>
+cosh(const complex<_UnderlyingType> &_z)
+{
+	assert(__detail::__is_finite(_z) && "finite_math::cosh: input is not finite");
+	__HYPERCOMPLEX_COUNT(hyperbolic);
+	const _UnderlyingType _e = std::exp(_z.real()), _ie = _UnderlyingType(1) / _e;
+	_UnderlyingType _s, _c;
+	__detail::__sincos<_Accuracy>(_z.imag(), _s, _c);
+	return complex<_UnderlyingType>(_c * _UnderlyingType(0.5) * (_e + _ie), _s * _UnderlyingType(0.5) * (_e - _ie));
+}
+} // namespace finite_math
+} // namespace hypercomplex
+#endif // FINITE_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : finite.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,336 @@
+// header-begin ------------------------------------------
+// File       : fir.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Streaming complex FIR filter. Short filters run a
+//      direct convolution over split real and imaginary
+//      buffers, vectorized across output samples; long ones
+//      use overlap-save FFT convolution. The filter keeps
+//      its history between process() calls, so a stream may
+//      be fed in blocks of any size and the output does not
+//      depend on how it was split. Neither path adds latency.
+//
+//      Overlap-save is uniformly partitioned: the first P
+//      taps run on the direct path, and the rest are cut
+//      into partitions of P taps whose spectra (FFT size 2P)
+//      are applied to a delay line of input block spectra.
+//      Each block of P inputs is transformed once, when it
+//      is complete, and gives the partitions' contribution
+//      to the next P outputs; since those only depend on
+//      inputs at least P samples old, it is ready in time.
+//      A stream fed in small calls so costs the same per
+//      sample as one fed in large ones.
+//
+// header-end --------------------------------------------
+
+#ifndef FIR_HPP
+#define FIR_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+#include "fft.hpp"
+#include "interleave.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <span>
+#include <stdexcept>
+
+namespace hypercomplex
+{
+enum class fir_method
+{
+	automatic,
+	direct,
+	overlap_save
+};
+
+// y[n] = sum_k taps[k] * x[n - k], with x[n] = 0 before the first sample
+template <typename _UnderlyingType> class fir_filter
+{
+  public:
+	// Filters with at most this many taps use the direct path when the
+	// method is automatic
+	static constexpr std::size_t direct_threshold = 64;
+
+  private:
+	// Output samples computed per pass of the direct path
+	static constexpr std::size_t __chunk = 256;
+
+	fir_method _method;
+	std::size_t _taps;
+	// The first _head taps, run on the direct path: all of them for
+	// direct, the first partition for overlap-save
+	std::size_t _head;
+	array<_UnderlyingType> _h_re, _h_im;
+
+	// Direct path: _x holds the last _head - 1 inputs followed by the
+	// chunk being filtered; _acc holds its outputs.
+	array<_UnderlyingType> _x_re, _x_im, _acc_re, _acc_im;
+
+	// Overlap-save, with partition length _step and _fft.size() = 2 *
+	// _step:
+	// _spectrum holds the spectra of the _partitions tail partitions,
+	//   scaled by 1 / _fft.size()
+	// _delay the spectra of the last _partitions input blocks, a ring
+	//   whose newest entry is _slot
+	// _block the previous input block followed by the _filled inputs
+	//   of the current one
+	// _tail the tail's contribution to the current block's outputs
+	// _work scratch for one spectrum
+	fft_plan<_UnderlyingType> _fft;
+	std::size_t _step = 0, _partitions = 0, _slot = 0, _filled = 0;
+	array<_UnderlyingType> _spectrum_re, _spectrum_im, _delay_re, _delay_im;
+	array<_UnderlyingType> _block_re, _block_im, _tail_re, _tail_im, _work_re, _work_im;
+
+	void
+	__direct(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n)
+	{
+		const std::size_t _history = _head - 1;
+		_UnderlyingType *__restrict _xr = _x_re.data();
+		_UnderlyingType *__restrict _xi = _x_im.data();
+		_UnderlyingType *__restrict _ar = _acc_re.data();
+		_UnderlyingType *__restrict _ai = _acc_im.data();
+		while (_n != 0)
+		{
+			const std::size_t _c = std::min(_n, __chunk);
+			__detail::__deinterleave(reinterpret_cast<const _UnderlyingType *>(_in), _xr + _history, _xi + _history, _c);
+			std::fill_n(_ar, _c, _UnderlyingType(0));
+			std::fill_n(_ai, _c, _UnderlyingType(0));
+			for (std::size_t _k = 0; _k < _head; ++_k)
+			{
+				const _UnderlyingType _hr = _h_re[_k], _hi = _h_im[_k];
+				const _UnderlyingType *_sr = _xr + _history - _k;
+				const _UnderlyingType *_si = _xi + _history - _k;
+				for (std::size_t _i = 0; _i < _c; ++_i)
+				{
+					_ar[_i] += _hr * _sr[_i] - _hi * _si[_i];
+					_ai[_i] += _hr * _si[_i] + _hi * _sr[_i];
+				}
+			}
+			__detail::__interleave(_ar, _ai, reinterpret_cast<_UnderlyingType *>(_out), _c);
+			std::copy_n(_xr + _c, _history, _xr);
+			std::copy_n(_xi + _c, _history, _xi);
+			_in += _c;
+			_out += _c;
+			_n -= _c;
+		}
+	}
+
+	// The current input block is complete: push its spectrum onto the
+	// delay line and compute the tail's contribution to the next block,
+	// sum over k of partition k applied to the block k steps back
+	void
+	__overlap_save_block()
+	{
+		const std::size_t _size = _fft.size();
+		_slot = _slot + 1 == _partitions ? 0 : _slot + 1;
+		_UnderlyingType *__restrict _xr = _delay_re.data() + _slot * _size;
+		_UnderlyingType *__restrict _xi = _delay_im.data() + _slot * _size;
+		std::copy_n(_block_re.data(), _size, _xr);
+		std::copy_n(_block_im.data(), _size, _xi);
+		_fft.forward(std::span(_xr, _size), std::span(_xi, _size));
+		std::copy_n(_block_re.data() + _step, _step, _block_re.data());
+		std::copy_n(_block_im.data() + _step, _step, _block_im.data());
+
+		_UnderlyingType *__restrict _wr = _work_re.data();
+		_UnderlyingType *__restrict _wi = _work_im.data();
+		std::fill_n(_wr, _size, _UnderlyingType(0));
+		std::fill_n(_wi, _size, _UnderlyingType(0));
+		for (std::size_t _k = 0; _k < _partitions; ++_k)
+		{
+			const std::size_t _from = (_slot + _partitions - _k) % _partitions;
+			const _UnderlyingType *__restrict _dr = _delay_re.data() + _from * _size;
+			const _UnderlyingType *__restrict _di = _delay_im.data() + _from * _size;
+			const _UnderlyingType *__restrict _hr = _spectrum_re.data() + _k * _size;
+			const _UnderlyingType *__restrict _hi = _spectrum_im.data() + _k * _size;
+			for (std::size_t _i = 0; _i < _size; ++_i)
+			{
+				_wr[_i] += _dr[_i] * _hr[_i] - _di[_i] * _hi[_i];
+				_wi[_i] += _dr[_i] * _hi[_i] + _di[_i] * _hr[_i];
+			}
+		}
+		_fft.inverse(std::span(_wr, _size), std::span(_wi, _size));
+		std::copy_n(_wr + _step, _step, _tail_re.data());
+		std::copy_n(_wi + _step, _step, _tail_im.data());
+	}
+
+	// Head on the direct path, plus the tail computed when the previous
+	// block completed
+	void
+	__overlap_save(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n)
+	{
+		while (_n != 0)
+		{
+			const std::size_t _c = std::min(_n, _step - _filled);
+			__direct(_in, _out, _c);
+			if (_partitions != 0)
+			{
+				_UnderlyingType *_y = reinterpret_cast<_UnderlyingType *>(_out);
+				for (std::size_t _i = 0; _i < _c; ++_i)
+				{
+					_y[2 * _i] += _tail_re[_filled + _i];
+					_y[2 * _i + 1] += _tail_im[_filled + _i];
+				}
+				__detail::__deinterleave(reinterpret_cast<const _UnderlyingType *>(_in),
+										 _block_re.data() + _step + _filled, _block_im.data() + _step + _filled, _c);
+			}
+			_filled += _c;
+			_in += _c;
+			_out += _c;
+			_n -= _c;
+			if (_filled == _step)
+			{
+				if (_partitions != 0)
+				{
+					__overlap_save_block();
+				}
+				_filled = 0;
+			}
+		}
+	}
+
+  public:
+	// _fft_size selects the overlap-save transform length, twice the
+	// partition length; zero picks a partition of sqrt(2 * taps) rounded
+	// up to a power of two, which balances the direct head against the
+	// spectral products.
+	// Throws std::invalid_argument for an empty filter or an FFT size
+	// that is not a power of two of at least 2.
+	explicit fir_filter(std::span<const complex<_UnderlyingType>> _coefficients,
+						fir_method _select = fir_method::automatic, std::size_t _fft_size = 0)
+		: _method(_select), _taps(_coefficients.size()), _head(_coefficients.size())
+	{
+		if (_taps == 0)
+		{
+			throw std::invalid_argument("fir_filter: no coefficients");
+		}
+		if (_method == fir_method::automatic)
+		{
+			_method = _taps <= direct_threshold ? fir_method::direct : fir_method::overlap_save;
+		}
+
+		if (_method == fir_method::overlap_save)
+		{
+			if (_fft_size != 0 && (_fft_size < 2 || !std::has_single_bit(_fft_size)))
+			{
+				throw std::invalid_argument("fir_filter: FFT size must be a power of two of at least 2");
+			}
+			const auto _balanced = static_cast<std::size_t>(std::sqrt(2.0 * static_cast<double>(_taps)));
+			_step = _fft_size != 0 ? _fft_size / 2 : std::bit_ceil(std::max<std::size_t>(_balanced, 1));
+			_head = std::min(_step, _taps);
+			_partitions = (_taps - _head + _step - 1) / _step;
+		}
+
+		_h_re.resize(_head);
+		_h_im.resize(_head);
+		for (std::size_t _k = 0; _k < _head; ++_k)
+		{
+			_h_re[_k] = _coefficients[_k].real();
+			_h_im[_k] = _coefficients[_k].imag();
+		}
+		_x_re.resize(_head - 1 + __chunk);
+		_x_im.resize(_head - 1 + __chunk);
+		_acc_re.resize(__chunk);
+		_acc_im.resize(__chunk);
+		if (_method == fir_method::direct)
+		{
+			return;
+		}
+
+		const std::size_t _size = 2 * _step;
+		_fft = fft_plan<_UnderlyingType>(_size);
+		_spectrum_re.resize(_partitions * _size);
+		_spectrum_im.resize(_partitions * _size);
+		_delay_re.resize(_partitions * _size);
+		_delay_im.resize(_partitions * _size);
+		_block_re.resize(_size);
+		_block_im.resize(_size);
+		_tail_re.resize(_step);
+		_tail_im.resize(_step);
+		_work_re.resize(_size);
+		_work_im.resize(_size);
+
+		const _UnderlyingType _scale = _UnderlyingType(1) / static_cast<_UnderlyingType>(_size);
+		for (std::size_t _k = 0; _k < _partitions; ++_k)
+		{
+			_UnderlyingType *_hr = _spectrum_re.data() + _k * _size;
+			_UnderlyingType *_hi = _spectrum_im.data() + _k * _size;
+			const std::size_t _first = _head + _k * _step;
+			const std::size_t _count = std::min(_step, _taps - _first);
+			for (std::size_t _i = 0; _i < _count; ++_i)
+			{
+				_hr[_i] = _coefficients[_first + _i].real() * _scale;
+				_hi[_i] = _coefficients[_first + _i].imag() * _scale;
+			}
+			_fft.forward(std::span(_hr, _size), std::span(_hi, _size));
+		}
+	}
+
+	inline fir_method
+	method() const noexcept
+	{
+		return _method;
+	}
+	inline std::size_t
+	taps() const noexcept
+	{
+		return _taps;
+	}
+	// Transform length of the overlap-save path, zero for direct
+	inline std::size_t
+	fft_size() const noexcept
+	{
+		return _fft.size();
+	}
+
+	// Filters the next _n samples of the stream. _in and _out may not
+	// overlap.
+	void
+	process(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n)
+	{
+		if (_method == fir_method::direct)
+		{
+			__direct(_in, _out, _n);
+		}
+		else
+		{
+			__overlap_save(_in, _out, _n);
+		}
+	}
+	void
+	process(std::span<const complex<_UnderlyingType>> _in, std::span<complex<_UnderlyingType>> _out)
+	{
+		assert(_out.size() >= _in.size());
+		process(_in.data(), _out.data(), _in.size());
+	}
+
+	// Forgets the stream history, as if no sample had been processed
+	void
+	reset()
+	{
+		for (array<_UnderlyingType> *_buffer : {&_x_re, &_x_im, &_delay_re, &_delay_im, &_block_re, &_block_im,
+												&_tail_re, &_tail_im})
+		{
+			std::fill(_buffer->begin(), _buffer->end(), _UnderlyingType(0));
+		}
+		_slot = 0;
+		_filled = 0;
+	}
+};
+} // namespace hypercomplex
+#endif // FIR_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : fir.hpp
+// footer-end --------------------------------------------
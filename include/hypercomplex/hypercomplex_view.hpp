@@ -0,0 +1,324 @@
+// header-begin ------------------------------------------
+// File       : hypercomplex_view.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      A view over a batch of hypercomplex numbers whose
+//      dimension (2, 4, 8, 16 or 32) is only known at run
+//      time. Each element is stored as dimension consecutive
+//      components, real part first. The batch functions
+//      switch on the dimension once per call and then run
+//      the same statically unrolled element kernel as the
+//      complex, quaternion and cayley_dickson types, so the
+//      per element cost does not depend on the dispatch.
+//
+// header-end --------------------------------------------
+
+#ifndef HYPERCOMPLEX_VIEW_HPP
+#define HYPERCOMPLEX_VIEW_HPP
+
+#include "cayley_dickson.hpp"
+#include "complex.hpp"
+#include "execution.hpp"
+#include "quaternion.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace hypercomplex
+{
+template <typename _UnderlyingType> class hypercomplex_view
+{
+  private:
+	std::span<_UnderlyingType> _components;
+	std::size_t _dimension;
+
+  public:
+	static constexpr bool
+	supported(std::size_t _d) noexcept
+	{
+		return _d == 2 || _d == 4 || _d == 8 || _d == 16 || _d == 32;
+	}
+
+	// _c.size() must be a multiple of _d
+	hypercomplex_view(std::span<_UnderlyingType> _c, std::size_t _d) : _components(_c), _dimension(_d)
+	{
+		if (!supported(_d))
+		{
+			throw std::invalid_argument("hypercomplex_view: dimension must be 2, 4, 8, 16 or 32");
+		}
+		if (_c.size() % _d != 0)
+		{
+			throw std::invalid_argument("hypercomplex_view: component count is not a multiple of the dimension");
+		}
+	}
+	template <typename _Other>
+		requires std::is_convertible_v<_Other (*)[], _UnderlyingType (*)[]>
+	hypercomplex_view(const hypercomplex_view<_Other> &_v) noexcept
+		: _components(_v.components()), _dimension(_v.dimension())
+	{
+	}
+
+	constexpr std::size_t
+	dimension() const noexcept
+	{
+		return _dimension;
+	}
+	// Number of hypercomplex elements
+	constexpr std::size_t
+	size() const noexcept
+	{
+		return _components.size() / _dimension;
+	}
+	constexpr std::span<_UnderlyingType>
+	components() const noexcept
+	{
+		return _components;
+	}
+	constexpr std::span<_UnderlyingType>
+	operator[](std::size_t _i) const
+	{
+		return _components.subspan(_i * _dimension, _dimension);
+	}
+	constexpr hypercomplex_view
+	subview(std::size_t _begin, std::size_t _end) const
+	{
+		return hypercomplex_view(_components.subspan(_begin * _dimension, (_end - _begin) * _dimension), _dimension);
+	}
+};
+
+// Batch Arithmetic
+// The inputs and the output must have the same dimension and size. The
+// output may be one of the inputs, but may not partially overlap them.
+template <typename _UnderlyingType>
+void add(hypercomplex_view<const std::type_identity_t<_UnderlyingType>>,
+		 hypercomplex_view<const std::type_identity_t<_UnderlyingType>>, hypercomplex_view<_UnderlyingType>);
+template <typename _UnderlyingType>
+void subtract(hypercomplex_view<const std::type_identity_t<_UnderlyingType>>,
+			  hypercomplex_view<const std::type_identity_t<_UnderlyingType>>, hypercomplex_view<_UnderlyingType>);
+template <typename _UnderlyingType>
+void multiply(hypercomplex_view<const std::type_identity_t<_UnderlyingType>>,
+			  hypercomplex_view<const std::type_identity_t<_UnderlyingType>>, hypercomplex_view<_UnderlyingType>);
+template <typename _UnderlyingType>
+void conj(hypercomplex_view<const std::type_identity_t<_UnderlyingType>>, hypercomplex_view<_UnderlyingType>);
+template <typename _UnderlyingType>
+void norm(hypercomplex_view<const std::type_identity_t<_UnderlyingType>>, std::span<_UnderlyingType>);
+
+namespace __detail
+{
+// Calls _fn(std::integral_constant<std::size_t, N>) for the run time
+// dimension; hypercomplex_view has already rejected any other value.
+template <typename _Function>
+inline decltype(auto)
+__with_dimension(std::size_t _dimension, _Function &&_fn)
+{
+	switch (_dimension)
+	{
+	case 2:
+		return _fn(std::integral_constant<std::size_t, 2>{});
+	case 4:
+		return _fn(std::integral_constant<std::size_t, 4>{});
+	case 8:
+		return _fn(std::integral_constant<std::size_t, 8>{});
+	case 16:
+		return _fn(std::integral_constant<std::size_t, 16>{});
+	default:
+		assert(_dimension == 32);
+		return _fn(std::integral_constant<std::size_t, 32>{});
+	}
+}
+
+// One element of dimension _Dimension, through the matching type
+template <std::size_t _Dimension, typename _UnderlyingType>
+inline void
+__multiply_element(const _UnderlyingType *_a, const _UnderlyingType *_b, _UnderlyingType *_out)
+{
+	if constexpr (_Dimension == 2)
+	{
+		const complex<_UnderlyingType> _r = complex<_UnderlyingType>(_a[0], _a[1]) * complex<_UnderlyingType>(_b[0], _b[1]);
+		_out[0] = _r.real();
+		_out[1] = _r.imag();
+	}
+	else if constexpr (_Dimension == 4)
+	{
+		const quaternion<_UnderlyingType> _r = quaternion<_UnderlyingType>(_a[0], _a[1], _a[2], _a[3])
+											   * quaternion<_UnderlyingType>(_b[0], _b[1], _b[2], _b[3]);
+		_out[0] = _r.w();
+		_out[1] = _r.x();
+		_out[2] = _r.y();
+		_out[3] = _r.z();
+	}
+	else
+	{
+		_UnderlyingType _r[_Dimension];
+		__cd_multiply<_Dimension>(_a, _b, _r);
+		for (std::size_t _i = 0; _i < _Dimension; ++_i)
+		{
+			_out[_i] = _r[_i];
+		}
+	}
+}
+
+template <std::size_t _Dimension, typename _UnderlyingType>
+inline void
+__multiply(const _UnderlyingType *_a, const _UnderlyingType *_b, _UnderlyingType *_out, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		__multiply_element<_Dimension>(_a + _i * _Dimension, _b + _i * _Dimension, _out + _i * _Dimension);
+	}
+}
+
+template <std::size_t _Dimension, typename _UnderlyingType>
+inline void
+__conj(const _UnderlyingType *_a, _UnderlyingType *_out, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_out[_i * _Dimension] = _a[_i * _Dimension];
+		for (std::size_t _k = 1; _k < _Dimension; ++_k)
+		{
+			_out[_i * _Dimension + _k] = -_a[_i * _Dimension + _k];
+		}
+	}
+}
+
+template <std::size_t _Dimension, typename _UnderlyingType>
+inline void
+__norm(const _UnderlyingType *_a, _UnderlyingType *_out, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_UnderlyingType _s = 0;
+		for (std::size_t _k = 0; _k < _Dimension; ++_k)
+		{
+			_s += _a[_i * _Dimension + _k] * _a[_i * _Dimension + _k];
+		}
+		_out[_i] = _s;
+	}
+}
+
+// Component wise operations do not depend on the dimension
+template <typename _UnderlyingType, typename _Operation>
+inline void
+__componentwise(hypercomplex_view<const _UnderlyingType> _a, hypercomplex_view<const _UnderlyingType> _b,
+				hypercomplex_view<_UnderlyingType> _out, _Operation _op)
+{
+	assert(_a.dimension() == _out.dimension() && _b.dimension() == _out.dimension());
+	assert(_a.size() == _out.size() && _b.size() == _out.size());
+	const _UnderlyingType *_pa = _a.components().data(), *_pb = _b.components().data();
+	_UnderlyingType *_po = _out.components().data();
+	const std::size_t _n = _out.components().size();
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_po[_i] = _op(_pa[_i], _pb[_i]);
+	}
+}
+} // namespace __detail
+
+template <typename _UnderlyingType>
+void
+add(hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+	hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _b, hypercomplex_view<_UnderlyingType> _out)
+{
+	__detail::__componentwise(_a, _b, _out, [](_UnderlyingType _x, _UnderlyingType _y) { return _x + _y; });
+}
+template <typename _UnderlyingType>
+void
+subtract(hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+		 hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _b, hypercomplex_view<_UnderlyingType> _out)
+{
+	__detail::__componentwise(_a, _b, _out, [](_UnderlyingType _x, _UnderlyingType _y) { return _x - _y; });
+}
+template <typename _UnderlyingType>
+void
+multiply(hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+		 hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _b, hypercomplex_view<_UnderlyingType> _out)
+{
+	assert(_a.dimension() == _out.dimension() && _b.dimension() == _out.dimension());
+	assert(_a.size() == _out.size() && _b.size() == _out.size());
+	__detail::__with_dimension(_out.dimension(),
+							   [&](auto _d)
+							   {
+								   __detail::__multiply<decltype(_d)::value>(_a.components().data(), _b.components().data(),
+															  _out.components().data(), _out.size());
+							   });
+}
+template <typename _UnderlyingType>
+void
+conj(hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a, hypercomplex_view<_UnderlyingType> _out)
+{
+	assert(_a.dimension() == _out.dimension() && _a.size() == _out.size());
+	__detail::__with_dimension(_out.dimension(), [&](auto _d)
+							   { __detail::__conj<decltype(_d)::value>(_a.components().data(), _out.components().data(), _out.size()); });
+}
+template <typename _UnderlyingType>
+void
+norm(hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a, std::span<_UnderlyingType> _out)
+{
+	assert(_out.size() >= _a.size());
+	__detail::__with_dimension(_a.dimension(), [&](auto _d)
+							   { __detail::__norm<decltype(_d)::value>(_a.components().data(), _out.data(), _a.size()); });
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+add(const _Policy &_policy, hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+	hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _b, hypercomplex_view<_UnderlyingType> _out)
+{
+	__detail::__for_each_chunk(_policy, _out.size(), [&](std::size_t _begin, std::size_t _end)
+							   { add<_UnderlyingType>(_a.subview(_begin, _end), _b.subview(_begin, _end),
+													  _out.subview(_begin, _end)); });
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+subtract(const _Policy &_policy, hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+		 hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _b, hypercomplex_view<_UnderlyingType> _out)
+{
+	__detail::__for_each_chunk(_policy, _out.size(), [&](std::size_t _begin, std::size_t _end)
+							   { subtract<_UnderlyingType>(_a.subview(_begin, _end), _b.subview(_begin, _end),
+														   _out.subview(_begin, _end)); });
+}
+// Split by element count; the higher dimensions do far more work per
+// element, so they get a proportionally smaller grain.
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+multiply(const _Policy &_policy, hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+		 hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _b, hypercomplex_view<_UnderlyingType> _out)
+{
+	const std::size_t _grain = __default_grain / (_out.dimension() * _out.dimension() / 4);
+	__detail::__for_each_chunk(
+		_policy, _out.size(), [&](std::size_t _begin, std::size_t _end)
+		{ multiply<_UnderlyingType>(_a.subview(_begin, _end), _b.subview(_begin, _end), _out.subview(_begin, _end)); },
+		_grain > 0 ? _grain : 1);
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+conj(const _Policy &_policy, hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+	 hypercomplex_view<_UnderlyingType> _out)
+{
+	__detail::__for_each_chunk(_policy, _out.size(), [&](std::size_t _begin, std::size_t _end)
+							   { conj<_UnderlyingType>(_a.subview(_begin, _end), _out.subview(_begin, _end)); });
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+norm(const _Policy &_policy, hypercomplex_view<const std::type_identity_t<_UnderlyingType>> _a,
+	 std::span<_UnderlyingType> _out)
+{
+	__detail::__for_each_chunk(_policy, _a.size(), [&](std::size_t _begin, std::size_t _end)
+							   { norm<_UnderlyingType>(_a.subview(_begin, _end), _out.subspan(_begin, _end - _begin)); });
+}
+} // namespace hypercomplex
+#endif // HYPERCOMPLEX_VIEW_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : hypercomplex_view.hpp
+// footer-end --------------------------------------------
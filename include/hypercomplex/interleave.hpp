@@ -0,0 +1,224 @@
+// header-begin ------------------------------------------
+// File       : interleave.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Conversions between interleaved complex data (re, im,
+//      re, im, ...) and split planes (re, re, ..., im, im,
+//      ...). The kernels work on the scalar storage through
+//      restrict pointers, so the compiler turns them into
+//      vector loads and shuffles. The in-place variants split
+//      the data block by block: each block of _block numbers
+//      becomes _block real parts followed by _block imaginary
+//      parts, which is the layout the split kernels want
+//      without a second buffer of the full size.
+//
+// header-end --------------------------------------------
+
+#ifndef INTERLEAVE_HPP
+#define INTERLEAVE_HPP
+
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace hypercomplex
+{
+// Largest block the in-place conversions accept; each block is staged
+// through a stack buffer of this many numbers
+constexpr std::size_t max_interleave_block = 256;
+// Default block: 64 numbers make every plane a whole number of cache lines
+constexpr std::size_t default_interleave_block = 64;
+
+// Views a span of complex numbers as its 2n scalars re0, im0, re1, ...
+template <typename _UnderlyingType>
+inline std::span<_UnderlyingType>
+as_scalars(std::span<complex<_UnderlyingType>> _data) noexcept
+{
+	return std::span<_UnderlyingType>(reinterpret_cast<_UnderlyingType *>(_data.data()), 2 * _data.size());
+}
+template <typename _UnderlyingType>
+inline std::span<const _UnderlyingType>
+as_scalars(std::span<const complex<_UnderlyingType>> _data) noexcept
+{
+	return std::span<const _UnderlyingType>(reinterpret_cast<const _UnderlyingType *>(_data.data()), 2 * _data.size());
+}
+
+// Split and interleaved conversions
+//      deinterleave          : _in[i] -> (_re[i], _im[i])
+//      interleave            : (_re[i], _im[i]) -> _out[i]
+//      deinterleave_in_place : interleaved -> blocked split, in _data
+//      interleave_in_place   : blocked split -> interleaved, in _data
+template <typename _UnderlyingType>
+void deinterleave(std::span<const complex<std::type_identity_t<_UnderlyingType>>>, std::span<_UnderlyingType>,
+				  std::span<_UnderlyingType>);
+template <typename _UnderlyingType>
+void interleave(std::span<const std::type_identity_t<_UnderlyingType>>,
+				std::span<const std::type_identity_t<_UnderlyingType>>, std::span<complex<_UnderlyingType>>);
+template <typename _UnderlyingType>
+void deinterleave_in_place(std::span<complex<_UnderlyingType>>, std::size_t = default_interleave_block);
+template <typename _UnderlyingType>
+void interleave_in_place(std::span<complex<_UnderlyingType>>, std::size_t = default_interleave_block);
+
+namespace __detail
+{
+// _s holds 2 * _n interleaved scalars
+template <typename _UnderlyingType>
+inline void
+__deinterleave(const _UnderlyingType *__restrict _s, _UnderlyingType *__restrict _re, _UnderlyingType *__restrict _im,
+			   std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_re[_i] = _s[2 * _i];
+		_im[_i] = _s[2 * _i + 1];
+	}
+}
+template <typename _UnderlyingType>
+inline void
+__interleave(const _UnderlyingType *__restrict _re, const _UnderlyingType *__restrict _im,
+			 _UnderlyingType *__restrict _s, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_s[2 * _i] = _re[_i];
+		_s[2 * _i + 1] = _im[_i];
+	}
+}
+
+inline void
+__check_interleave_block(std::size_t _block)
+{
+	if (_block == 0 || _block > max_interleave_block)
+	{
+		throw std::invalid_argument("interleave: block must be in [1, max_interleave_block]");
+	}
+}
+
+// Converts blocks [_first, _last) of the _n numbers at _s. The final
+// block may be shorter than _block and is split over its own length.
+template <bool _Split, typename _UnderlyingType>
+inline void
+__interleave_blocks(_UnderlyingType *_s, std::size_t _n, std::size_t _block, std::size_t _first, std::size_t _last)
+{
+	_UnderlyingType _re[max_interleave_block], _im[max_interleave_block];
+	for (std::size_t _b = _first; _b < _last; ++_b)
+	{
+		const std::size_t _begin = _b * _block;
+		const std::size_t _len = std::min(_block, _n - _begin);
+		_UnderlyingType *_p = _s + 2 * _begin;
+		if constexpr (_Split)
+		{
+			__deinterleave(_p, _re, _im, _len);
+			std::copy_n(_re, _len, _p);
+			std::copy_n(_im, _len, _p + _len);
+		}
+		else
+		{
+			std::copy_n(_p, _len, _re);
+			std::copy_n(_p + _len, _len, _im);
+			__interleave(_re, _im, _p, _len);
+		}
+	}
+}
+
+template <bool _Split, typename _Policy, typename _UnderlyingType>
+inline void
+__interleave_in_place(const _Policy &_policy, std::span<complex<_UnderlyingType>> _data, std::size_t _block)
+{
+	__check_interleave_block(_block);
+	_UnderlyingType *_s = as_scalars(_data).data();
+	const std::size_t _n = _data.size();
+	const std::size_t _blocks = (_n + _block - 1) / _block;
+	__for_each_chunk(
+		_policy, _blocks,
+		[&](std::size_t _begin, std::size_t _end) { __interleave_blocks<_Split>(_s, _n, _block, _begin, _end); },
+		std::max<std::size_t>(1, __default_grain / _block));
+}
+} // namespace __detail
+
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+deinterleave(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in,
+			 std::span<_UnderlyingType> _re, std::span<_UnderlyingType> _im)
+{
+	assert(_re.size() >= _in.size() && _im.size() >= _in.size());
+	const _UnderlyingType *_s = as_scalars(_in).data();
+	__detail::__for_each_chunk(_policy, _in.size(),
+							   [&](std::size_t _begin, std::size_t _end) {
+								   __detail::__deinterleave(_s + 2 * _begin, _re.data() + _begin, _im.data() + _begin,
+															_end - _begin);
+							   });
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+interleave(const _Policy &_policy, std::span<const std::type_identity_t<_UnderlyingType>> _re,
+		   std::span<const std::type_identity_t<_UnderlyingType>> _im, std::span<complex<_UnderlyingType>> _out)
+{
+	assert(_re.size() == _im.size() && _out.size() >= _re.size());
+	_UnderlyingType *_s = as_scalars(_out).data();
+	__detail::__for_each_chunk(_policy, _re.size(),
+							   [&](std::size_t _begin, std::size_t _end) {
+								   __detail::__interleave(_re.data() + _begin, _im.data() + _begin, _s + 2 * _begin,
+														  _end - _begin);
+							   });
+}
+// Throws std::invalid_argument unless 0 < _block <= max_interleave_block
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+deinterleave_in_place(const _Policy &_policy, std::span<complex<_UnderlyingType>> _data,
+					  std::size_t _block = default_interleave_block)
+{
+	__detail::__interleave_in_place<true>(_policy, _data, _block);
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+interleave_in_place(const _Policy &_policy, std::span<complex<_UnderlyingType>> _data,
+					std::size_t _block = default_interleave_block)
+{
+	__detail::__interleave_in_place<false>(_policy, _data, _block);
+}
+
+template <typename _UnderlyingType>
+void
+deinterleave(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _in, std::span<_UnderlyingType> _re,
+			 std::span<_UnderlyingType> _im)
+{
+	deinterleave(execution::seq, _in, _re, _im);
+}
+template <typename _UnderlyingType>
+void
+interleave(std::span<const std::type_identity_t<_UnderlyingType>> _re,
+		   std::span<const std::type_identity_t<_UnderlyingType>> _im, std::span<complex<_UnderlyingType>> _out)
+{
+	interleave(execution::seq, _re, _im, _out);
+}
+template <typename _UnderlyingType>
+void
+deinterleave_in_place(std::span<complex<_UnderlyingType>> _data, std::size_t _block)
+{
+	__detail::__interleave_in_place<true>(execution::seq, _data, _block);
+}
+template <typename _UnderlyingType>
+void
+interleave_in_place(std::span<complex<_UnderlyingType>> _data, std::size_t _block)
+{
+	__detail::__interleave_in_place<false>(execution::seq, _data, _block);
+}
+} // namespace hypercomplex
+#endif // INTERLEAVE_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : interleave.hpp
+// footer-end --------------------------------------------
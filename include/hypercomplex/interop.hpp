@@ -0,0 +1,152 @@
+// header-begin ------------------------------------------
+// File       : interop.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Moving buffers between hypercomplex::complex,
+//      std::complex and cuda::std::complex (when its header
+//      is available). Types that store the same two scalars
+//      the same way are viewed as one another with
+//      reinterpret_span, without a copy; everything else goes
+//      through convert, which works on the scalar storage of
+//      both sides so the loop vectorizes.
+//
+// header-end --------------------------------------------
+
+#ifndef INTEROP_HPP
+#define INTEROP_HPP
+
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <cassert>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#if __has_include(<cuda/std/complex>)
+#include <cuda/std/complex>
+#define __HYPERCOMPLEX_HAS_CUDA_COMPLEX 1
+#endif
+
+namespace hypercomplex
+{
+// complex_layout<_Tp>::value is true for the complex types this header
+// knows; value_type is then their scalar type. Other complex types can be
+// added by specializing it, provided they store the real part and then
+// the imaginary part and nothing else.
+template <typename _Tp> struct complex_layout : std::false_type
+{
+};
+template <typename _Tp> struct complex_layout<const _Tp> : complex_layout<_Tp>
+{
+};
+template <typename _UnderlyingType> struct complex_layout<complex<_UnderlyingType>> : std::true_type
+{
+	using value_type = _UnderlyingType;
+};
+template <typename _UnderlyingType> struct complex_layout<std::complex<_UnderlyingType>> : std::true_type
+{
+	using value_type = _UnderlyingType;
+};
+#ifdef __HYPERCOMPLEX_HAS_CUDA_COMPLEX
+template <typename _UnderlyingType> struct complex_layout<cuda::std::complex<_UnderlyingType>> : std::true_type
+{
+	using value_type = _UnderlyingType;
+};
+#endif
+
+// True when a _From object may be read as a _To: both are complex types
+// with the same scalar type, both are two scalars wide and standard
+// layout. Alignment may still differ; reinterpret_span checks it.
+template <typename _To, typename _From>
+inline constexpr bool is_layout_compatible_v = [] {
+	using _T = std::remove_cv_t<_To>;
+	using _F = std::remove_cv_t<_From>;
+	if constexpr (complex_layout<_T>::value && complex_layout<_F>::value)
+	{
+		using _Scalar = typename complex_layout<_T>::value_type;
+		return std::is_same_v<_Scalar, typename complex_layout<_F>::value_type> && sizeof(_T) == 2 * sizeof(_Scalar) &&
+			   sizeof(_F) == 2 * sizeof(_Scalar) && std::is_standard_layout_v<_T> && std::is_standard_layout_v<_F>;
+	}
+	else
+	{
+		return false;
+	}
+}();
+
+static_assert(is_layout_compatible_v<complex<float>, std::complex<float>>);
+static_assert(is_layout_compatible_v<complex<double>, std::complex<double>>);
+#ifdef __HYPERCOMPLEX_HAS_CUDA_COMPLEX
+static_assert(is_layout_compatible_v<complex<float>, cuda::std::complex<float>>);
+static_assert(is_layout_compatible_v<complex<double>, cuda::std::complex<double>>);
+#endif
+
+// Views _s as a span of _To without copying. _To must be const if _From
+// is. cuda::std::complex is aligned to its full size, so viewing other
+// buffers as it throws std::invalid_argument when the data is not.
+template <typename _To, typename _From>
+std::span<_To>
+reinterpret_span(std::span<_From> _s)
+{
+	static_assert(is_layout_compatible_v<_To, _From>, "reinterpret_span: layouts differ, use convert");
+	static_assert(std::is_const_v<_To> || !std::is_const_v<_From>, "reinterpret_span: casts away const");
+	if constexpr (alignof(_To) > alignof(_From))
+	{
+		if (reinterpret_cast<std::uintptr_t>(_s.data()) % alignof(_To) != 0)
+		{
+			throw std::invalid_argument("reinterpret_span: data is not aligned for the target type");
+		}
+	}
+	return std::span<_To>(reinterpret_cast<_To *>(_s.data()), _s.size());
+}
+
+namespace __detail
+{
+template <typename _ToScalar, typename _FromScalar>
+inline void
+__convert_scalars(const _FromScalar *__restrict _in, _ToScalar *__restrict _out, std::size_t _n)
+{
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_out[_i] = static_cast<_ToScalar>(_in[_i]);
+	}
+}
+} // namespace __detail
+
+// Copies _in into _out, converting between any two complex types the
+// traits know, e.g. std::complex<double> to complex<float>
+template <execution::execution_policy _Policy, typename _From, typename _To>
+void
+convert(const _Policy &_policy, std::span<const _From> _in, std::span<_To> _out)
+{
+	static_assert(complex_layout<_From>::value && complex_layout<_To>::value, "convert: not a known complex type");
+	using _FromScalar = typename complex_layout<_From>::value_type;
+	using _ToScalar = typename complex_layout<_To>::value_type;
+	static_assert(sizeof(_From) == 2 * sizeof(_FromScalar) && sizeof(_To) == 2 * sizeof(_ToScalar));
+	assert(_out.size() >= _in.size());
+	const _FromScalar *_s = reinterpret_cast<const _FromScalar *>(_in.data());
+	_ToScalar *_d = reinterpret_cast<_ToScalar *>(_out.data());
+	__detail::__for_each_chunk(_policy, _in.size(), [&](std::size_t _begin, std::size_t _end)
+							   { __detail::__convert_scalars(_s + 2 * _begin, _d + 2 * _begin, 2 * (_end - _begin)); });
+}
+template <typename _From, typename _To>
+void
+convert(std::span<const _From> _in, std::span<_To> _out)
+{
+	convert(execution::seq, _in, _out);
+}
+} // namespace hypercomplex
+#endif // INTEROP_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : interop.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,429 @@
+// header-begin ------------------------------------------
+// File       : lu.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      LU factorization with partial pivoting, P A = L U, of a
+//      square complex matrix. The factorization is right
+//      looking and blocked: each step factors a panel of
+//      __block columns, solves for the matching block row of
+//      U and then updates the trailing matrix, which is where
+//      nearly all of the work is. The block row solve and the
+//      trailing update are split across threads. The factors
+//      are kept, so one factorization serves any number of
+//      solve() / solve_many() calls.
+//
+//      The trailing update runs a register-blocked
+//      micro-kernel: __mr rows by __nr columns of the result
+//      are accumulated in registers over the whole panel
+//      depth, reading U12 from a copy packed by strips of
+//      __nr columns with the real and imaginary parts split.
+//      The packed copy is taken once per factorization and
+//      reused by every panel.
+//
+// header-end --------------------------------------------
+
+#ifndef LU_HPP
+#define LU_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace hypercomplex
+{
+namespace __detail
+{
+// _row[0, _n) -= _a * _u[0, _n), on interleaved scalars
+template <typename _UnderlyingType>
+inline void
+__complex_axpy(_UnderlyingType *__restrict _row, complex<_UnderlyingType> _a, const _UnderlyingType *__restrict _u,
+			   std::size_t _n)
+{
+	const _UnderlyingType _ar = _a.real(), _ai = _a.imag();
+	for (std::size_t _c = 0; _c < _n; ++_c)
+	{
+		const _UnderlyingType _ur = _u[2 * _c], _ui = _u[2 * _c + 1];
+		_row[2 * _c] -= _ar * _ur - _ai * _ui;
+		_row[2 * _c + 1] -= _ar * _ui + _ai * _ur;
+	}
+}
+
+// _a[_r][0, _Nr) -= sum over _p of _l[_r][_p] * u[_p][0, _Nr) for _Mr rows.
+// _a and _l are interleaved rows _lda and _ldl scalars apart; u is a
+// packed strip, row _p at _ur + _p * _Nr and _ui + _p * _Nr.
+template <std::size_t _Mr, std::size_t _Nr, typename _UnderlyingType>
+inline void
+__lu_micro_kernel(_UnderlyingType *__restrict _a, std::size_t _lda, const _UnderlyingType *__restrict _l,
+				  std::size_t _ldl, const _UnderlyingType *__restrict _ur, const _UnderlyingType *__restrict _ui,
+				  std::size_t _depth)
+{
+	_UnderlyingType _sr[_Mr][_Nr] = {}, _si[_Mr][_Nr] = {};
+	for (std::size_t _p = 0; _p < _depth; ++_p)
+	{
+		const _UnderlyingType *_vr = _ur + _p * _Nr, *_vi = _ui + _p * _Nr;
+		for (std::size_t _r = 0; _r < _Mr; ++_r)
+		{
+			const _UnderlyingType _lr = _l[_r * _ldl + 2 * _p], _li = _l[_r * _ldl + 2 * _p + 1];
+			for (std::size_t _c = 0; _c < _Nr; ++_c)
+			{
+				_sr[_r][_c] += _lr * _vr[_c] - _li * _vi[_c];
+				_si[_r][_c] += _lr * _vi[_c] + _li * _vr[_c];
+			}
+		}
+	}
+	for (std::size_t _r = 0; _r < _Mr; ++_r)
+	{
+		for (std::size_t _c = 0; _c < _Nr; ++_c)
+		{
+			_a[_r * _lda + 2 * _c] -= _sr[_r][_c];
+			_a[_r * _lda + 2 * _c + 1] -= _si[_r][_c];
+		}
+	}
+}
+} // namespace __detail
+
+template <typename _UnderlyingType> class lu_decomposition
+{
+  private:
+	// Panel width of the blocked factorization
+	static constexpr std::size_t __block = 64;
+	// Columns of the trailing matrix updated per pass; a tile of the
+	// block row of U is then __block * __tile numbers and stays in L2
+	static constexpr std::size_t __tile = 128;
+	// Micro-kernel shape: __mr rows by __nr columns, 2 * __mr * __nr
+	// accumulators, which fit the vector registers of SSE2 and AVX2
+	static constexpr std::size_t __mr = 4;
+	static constexpr std::size_t __nr = 32 / sizeof(_UnderlyingType);
+	static_assert(__tile % __nr == 0, "a column tile must hold whole strips");
+
+	// L below the diagonal (unit diagonal implied), U on and above it
+	matrix<complex<_UnderlyingType>> _lu;
+	// Row _j was swapped with row _pivots[_j] at step _j
+	array<std::size_t> _pivots;
+	bool _singular = false;
+
+	static _UnderlyingType
+	__magnitude(const complex<_UnderlyingType> &_z)
+	{
+		// |re| + |im|, as LAPACK uses to choose complex pivots
+		return std::abs(_z.real()) + std::abs(_z.imag());
+	}
+
+	_UnderlyingType *
+	__scalars(std::size_t _r, std::size_t _c)
+	{
+		return reinterpret_cast<_UnderlyingType *>(_lu.data() + _r * _lu.stride() + _c);
+	}
+
+	// Unblocked LU of columns [_k, _k + _w) over rows [_k, n). Rows are
+	// swapped across the full width, which applies each interchange to
+	// L, the panel and the trailing matrix at once.
+	void
+	__factor_panel(std::size_t _k, std::size_t _w)
+	{
+		const std::size_t _n = _lu.rows();
+		for (std::size_t _j = _k; _j < _k + _w; ++_j)
+		{
+			std::size_t _p = _j;
+			_UnderlyingType _best = __magnitude(_lu(_j, _j));
+			for (std::size_t _i = _j + 1; _i < _n; ++_i)
+			{
+				const _UnderlyingType _m = __magnitude(_lu(_i, _j));
+				if (_m > _best)
+				{
+					_best = _m;
+					_p = _i;
+				}
+			}
+			_pivots[_j] = _p;
+			if (_p != _j)
+			{
+				std::swap_ranges(_lu.row(_j).begin(), _lu.row(_j).end(), _lu.row(_p).begin());
+			}
+			if (_best == _UnderlyingType(0))
+			{
+				_singular = true;
+				continue;
+			}
+
+			const complex<_UnderlyingType> _inverse = complex<_UnderlyingType>(1) / _lu(_j, _j);
+			const std::size_t _rest = _k + _w - (_j + 1);
+			const _UnderlyingType *_u = __scalars(_j, _j + 1);
+			for (std::size_t _i = _j + 1; _i < _n; ++_i)
+			{
+				const complex<_UnderlyingType> _l = _lu(_i, _j) * _inverse;
+				_lu(_i, _j) = _l;
+				__detail::__complex_axpy(__scalars(_i, _j + 1), _l, _u, _rest);
+			}
+		}
+	}
+
+	template <typename _Policy>
+	void
+	__factor(const _Policy &_policy)
+	{
+		const std::size_t _n = _lu.rows();
+		// Real and imaginary parts of U12, packed by strips of __nr
+		// columns; the strip starting at column _s * __nr holds row _p at
+		// offset (_s * _w + _p) * __nr
+		const std::size_t _first = std::min(__block, _n);
+		array<_UnderlyingType> _packed(2 * _first * (_n - _first));
+		_UnderlyingType *const _ur = _packed.data(), *const _ui = _ur + _first * (_n - _first);
+		for (std::size_t _k = 0; _k < _n; _k += __block)
+		{
+			const std::size_t _w = std::min(__block, _n - _k);
+			const std::size_t _next = _k + _w;
+			__factor_panel(_k, _w);
+			if (_next == _n)
+			{
+				break;
+			}
+			const std::size_t _cols = _n - _next;
+
+			// U12 = L11^-1 A12, by rows of the block, split over columns
+			__detail::__for_each_chunk(
+				_policy, _cols,
+				[&](std::size_t _begin, std::size_t _end)
+				{
+					for (std::size_t _i = _k + 1; _i < _next; ++_i)
+					{
+						for (std::size_t _p = _k; _p < _i; ++_p)
+						{
+							__detail::__complex_axpy(__scalars(_i, _next + _begin), _lu(_i, _p),
+													 __scalars(_p, _next + _begin), _end - _begin);
+						}
+					}
+				},
+				std::max<std::size_t>(__tile, __default_grain / _w));
+
+			// Pack the whole strips of U12; the columns past the last one
+			// are updated from U12 in place
+			const std::size_t _strips = _cols / __nr;
+			__detail::__for_each_chunk(
+				_policy, _strips,
+				[&](std::size_t _begin, std::size_t _end)
+				{
+					for (std::size_t _s = _begin; _s < _end; ++_s)
+					{
+						for (std::size_t _p = 0; _p < _w; ++_p)
+						{
+							const _UnderlyingType *_u = __scalars(_k + _p, _next + _s * __nr);
+							const std::size_t _at = (_s * _w + _p) * __nr;
+							for (std::size_t _c = 0; _c < __nr; ++_c)
+							{
+								_ur[_at + _c] = _u[2 * _c];
+								_ui[_at + _c] = _u[2 * _c + 1];
+							}
+						}
+					}
+				},
+				std::max<std::size_t>(1, __default_grain / (_w * __nr)));
+
+			// A22 -= L21 U12, split over rows, tiled over columns. Blocks of
+			// __mr rows go through the micro-kernel a strip at a time; the
+			// rows and columns left over use the row-by-row update.
+			const std::size_t _lda = 2 * _lu.stride();
+			__detail::__for_each_chunk(
+				_policy, _n - _next,
+				[&](std::size_t _begin, std::size_t _end)
+				{
+					const std::size_t _r0 = _next + _begin, _r1 = _next + _end;
+					const std::size_t _blocked = _r0 + (_r1 - _r0) / __mr * __mr;
+					for (std::size_t _c = _next; _c < _n; _c += __tile)
+					{
+						const std::size_t _len = std::min(__tile, _n - _c);
+						const std::size_t _s0 = (_c - _next) / __nr;
+						const std::size_t _s1 = std::min(_strips, (_c + _len - _next) / __nr);
+						const std::size_t _whole = (_s1 - _s0) * __nr;
+						for (std::size_t _i = _r0; _i < _blocked; _i += __mr)
+						{
+							for (std::size_t _s = _s0; _s < _s1; ++_s)
+							{
+								__detail::__lu_micro_kernel<__mr, __nr>(__scalars(_i, _next + _s * __nr), _lda,
+																		__scalars(_i, _k), _lda, _ur + _s * _w * __nr,
+																		_ui + _s * _w * __nr, _w);
+							}
+							for (std::size_t _r = _i; _r < _i + __mr && _whole < _len; ++_r)
+							{
+								for (std::size_t _p = _k; _p < _next; ++_p)
+								{
+									__detail::__complex_axpy(__scalars(_r, _c + _whole), _lu(_r, _p),
+															 __scalars(_p, _c + _whole), _len - _whole);
+								}
+							}
+						}
+						for (std::size_t _i = _blocked; _i < _r1; ++_i)
+						{
+							_UnderlyingType *_row = __scalars(_i, _c);
+							for (std::size_t _p = _k; _p < _next; ++_p)
+							{
+								__detail::__complex_axpy(_row, _lu(_i, _p), __scalars(_p, _c), _len);
+							}
+						}
+					}
+				},
+				std::max<std::size_t>(__mr, __default_grain / (_w * _cols / 64 + 1)));
+		}
+	}
+
+	void
+	__check_solvable(std::size_t _rows) const
+	{
+		if (_singular)
+		{
+			throw std::invalid_argument("lu_decomposition: matrix is singular");
+		}
+		if (_rows != _lu.rows())
+		{
+			throw std::invalid_argument("lu_decomposition: right-hand side has the wrong size");
+		}
+	}
+
+  public:
+	lu_decomposition() = default;
+	// Throws std::invalid_argument unless _a is square. A singular
+	// matrix factors, but solve() on it throws.
+	template <execution::execution_policy _Policy, typename _Alloc>
+	lu_decomposition(const _Policy &_policy, const matrix<complex<_UnderlyingType>, _Alloc> &_a)
+		: _lu(_a.rows(), _a.cols()), _pivots(_a.rows())
+	{
+		if (_a.rows() != _a.cols())
+		{
+			throw std::invalid_argument("lu_decomposition: matrix must be square");
+		}
+		std::copy(_a.begin(), _a.end(), _lu.begin());
+		__factor(_policy);
+	}
+	template <typename _Alloc>
+	explicit lu_decomposition(const matrix<complex<_UnderlyingType>, _Alloc> &_a)
+		: lu_decomposition(execution::seq, _a)
+	{
+	}
+
+	inline std::size_t
+	size() const noexcept
+	{
+		return _lu.rows();
+	}
+	inline bool
+	singular() const noexcept
+	{
+		return _singular;
+	}
+	// L (strictly lower, unit diagonal implied) and U packed together
+	inline const matrix<complex<_UnderlyingType>> &
+	factors() const noexcept
+	{
+		return _lu;
+	}
+	inline std::span<const std::size_t>
+	pivots() const noexcept
+	{
+		return std::span<const std::size_t>(_pivots.data(), _pivots.size());
+	}
+
+	// Solves A x = _b in place
+	void
+	solve(std::span<complex<_UnderlyingType>> _b) const
+	{
+		__check_solvable(_b.size());
+		const std::size_t _n = _lu.rows();
+		for (std::size_t _j = 0; _j < _n; ++_j)
+		{
+			std::swap(_b[_j], _b[_pivots[_j]]);
+		}
+		for (std::size_t _i = 1; _i < _n; ++_i)
+		{
+			const std::span<const complex<_UnderlyingType>> _l = _lu.row(_i);
+			complex<_UnderlyingType> _s = _b[_i];
+			for (std::size_t _j = 0; _j < _i; ++_j)
+			{
+				_s -= _l[_j] * _b[_j];
+			}
+			_b[_i] = _s;
+		}
+		for (std::size_t _i = _n; _i-- > 0;)
+		{
+			const std::span<const complex<_UnderlyingType>> _u = _lu.row(_i);
+			complex<_UnderlyingType> _s = _b[_i];
+			for (std::size_t _j = _i + 1; _j < _n; ++_j)
+			{
+				_s -= _u[_j] * _b[_j];
+			}
+			_b[_i] = _s / _u[_i];
+		}
+	}
+
+	// Solves A X = _b in place for every column of the n x k matrix _b.
+	// Each step is a row update of _b, split over its columns.
+	template <execution::execution_policy _Policy, typename _Alloc>
+	void
+	solve_many(const _Policy &_policy, matrix<complex<_UnderlyingType>, _Alloc> &_b) const
+	{
+		__check_solvable(_b.rows());
+		const std::size_t _n = _lu.rows(), _k = _b.cols();
+		auto _scalars = [&](std::size_t _r, std::size_t _c)
+		{ return reinterpret_cast<_UnderlyingType *>(_b.data() + _r * _b.stride() + _c); };
+		for (std::size_t _j = 0; _j < _n; ++_j)
+		{
+			if (_pivots[_j] != _j)
+			{
+				std::swap_ranges(_b.row(_j).begin(), _b.row(_j).end(), _b.row(_pivots[_j]).begin());
+			}
+		}
+		__detail::__for_each_chunk(
+			_policy, _k,
+			[&](std::size_t _begin, std::size_t _end)
+			{
+				const std::size_t _len = _end - _begin;
+				for (std::size_t _i = 1; _i < _n; ++_i)
+				{
+					for (std::size_t _j = 0; _j < _i; ++_j)
+					{
+						__detail::__complex_axpy(_scalars(_i, _begin), _lu(_i, _j),
+												 static_cast<const _UnderlyingType *>(_scalars(_j, _begin)), _len);
+					}
+				}
+				for (std::size_t _i = _n; _i-- > 0;)
+				{
+					for (std::size_t _j = _i + 1; _j < _n; ++_j)
+					{
+						__detail::__complex_axpy(_scalars(_i, _begin), _lu(_i, _j),
+												 static_cast<const _UnderlyingType *>(_scalars(_j, _begin)), _len);
+					}
+					const complex<_UnderlyingType> _inverse = complex<_UnderlyingType>(1) / _lu(_i, _i);
+					for (std::size_t _c = _begin; _c < _end; ++_c)
+					{
+						_b(_i, _c) = _b(_i, _c) * _inverse;
+					}
+				}
+			},
+			std::max<std::size_t>(1, __default_grain / (_n + 1)));
+	}
+	template <typename _Alloc>
+	void
+	solve_many(matrix<complex<_UnderlyingType>, _Alloc> &_b) const
+	{
+		solve_many(execution::seq, _b);
+	}
+};
+} // namespace hypercomplex
+#endif // LU_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : lu.hpp
+// footer-end --------------------------------------------
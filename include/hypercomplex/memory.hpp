@@ -0,0 +1,324 @@
+// header-begin ------------------------------------------
+// File       : memory.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Allocation support for complex buffers: an aligned
+//      allocator for the containers in array.hpp and a bump
+//      arena (a std::pmr::memory_resource) for scratch space.
+//      An arena sized once up front lets a processing loop
+//      run without touching the heap.
+//
+//      first_touch_allocator spreads large blocks over the
+//      NUMA nodes the way a thread_placement::numa pool
+//      splits work on them, see execution.hpp.
+//
+// header-end --------------------------------------------
+
+#ifndef MEMORY_HPP
+#define MEMORY_HPP
+
+#include "execution.hpp"
+#include "numa.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <type_traits>
+
+namespace hypercomplex
+{
+// Cache line / widest vector register alignment used by default
+constexpr std::size_t __default_alignment = 64;
+
+// Class Forward Decleration
+template <typename _Tp, std::size_t _Align = __default_alignment> class aligned_allocator;
+template <typename _Tp, std::size_t _Align = __default_alignment> class first_touch_allocator;
+class arena;
+
+template <typename _Tp, std::size_t _Align> class aligned_allocator
+{
+	static_assert(_Align >= alignof(_Tp) && (_Align & (_Align - 1)) == 0,
+				  "_Align must be a power of two no smaller than alignof(_Tp)");
+
+  public:
+	using value_type = _Tp;
+	using is_always_equal = std::true_type;
+
+	template <typename _Up> struct rebind
+	{
+		using other = aligned_allocator<_Up, _Align>;
+	};
+
+	constexpr aligned_allocator() noexcept = default;
+	template <typename _Up> constexpr aligned_allocator(const aligned_allocator<_Up, _Align> &) noexcept {}
+
+	[[nodiscard]] _Tp *
+	allocate(std::size_t _n)
+	{
+		return static_cast<_Tp *>(::operator new(_n * sizeof(_Tp), std::align_val_t(_Align)));
+	}
+	void
+	deallocate(_Tp *_p, std::size_t _n) noexcept
+	{
+		::operator delete(_p, _n * sizeof(_Tp), std::align_val_t(_Align));
+	}
+
+	template <typename _Up>
+	constexpr bool
+	operator==(const aligned_allocator<_Up, _Align> &) const noexcept
+	{
+		return true;
+	}
+};
+
+// Smallest block first_touch_allocator places explicitly; below this
+// the cost of a parallel pass outweighs where a handful of pages live
+constexpr std::size_t __first_touch_threshold = std::size_t(1) << 20;
+
+namespace __detail
+{
+// The whole pages in [_p, _p + _bytes) are touched by a parallel_for
+// over them, and each is bound (when libnuma is available) to the node
+// of the worker that parallel_for queues its chunk on, node_of(q) for
+// chunk c of C on queue q = c * size() / C. The partial pages at either
+// end are left to whoever touches them.
+inline void
+__first_touch(thread_pool &_pool, void *_p, std::size_t _bytes)
+{
+	const numa_topology &_topology = numa_topology::system();
+	const std::size_t _page = numa_topology::page_size();
+	const std::uintptr_t _begin = (reinterpret_cast<std::uintptr_t>(_p) + _page - 1) & ~(std::uintptr_t(_page) - 1);
+	const std::uintptr_t _end = (reinterpret_cast<std::uintptr_t>(_p) + _bytes) & ~(std::uintptr_t(_page) - 1);
+	if (_end <= _begin)
+	{
+		return;
+	}
+	const std::size_t _pages = (_end - _begin) / _page;
+	constexpr std::size_t _grain = 16;
+	// Chunk _c covers pages [_pages * _c / _count, _pages * (_c + 1) / _count),
+	// as in parallel_for; runs of chunks on one node are bound together
+	const std::size_t _count = _pool.chunks(_pages, _grain);
+	auto _node_of_chunk = [&](std::size_t _c) { return _pool.node_of(_c * _pool.size() / _count); };
+	std::size_t _run = 0;
+	for (std::size_t _c = 0; _c < _count; ++_c)
+	{
+		const std::size_t _node = _node_of_chunk(_c);
+		if (_c + 1 == _count || _node_of_chunk(_c + 1) != _node)
+		{
+			const std::size_t _last = _pages * (_c + 1) / _count;
+			_topology.bind_memory(reinterpret_cast<void *>(_begin + _run * _page), (_last - _run) * _page, _node);
+			_run = _last;
+		}
+	}
+	_pool.parallel_for(
+		0, _pages,
+		[_begin, _page](std::size_t _b, std::size_t _e)
+		{
+			for (std::size_t _k = _b; _k < _e; ++_k)
+			{
+				*reinterpret_cast<volatile std::byte *>(_begin + _k * _page) = std::byte{0};
+			}
+		},
+		_grain);
+}
+} // namespace __detail
+
+// Aligned allocator for data processed on a thread_placement::numa
+// pool. Blocks of at least __first_touch_threshold bytes have their
+// pages placed on the node whose workers get that part of an equally
+// long range, so element-wise kernels over the container mostly read
+// local memory. On any other pool it is aligned_allocator. Only fresh
+// pages can be placed: memory the heap recycles keeps the node it was
+// first touched on.
+template <typename _Tp, std::size_t _Align> class first_touch_allocator
+{
+	static_assert(_Align >= alignof(_Tp) && (_Align & (_Align - 1)) == 0,
+				  "_Align must be a power of two no smaller than alignof(_Tp)");
+
+	template <typename, std::size_t> friend class first_touch_allocator;
+
+	// default_pool() when null
+	thread_pool *_pool = nullptr;
+
+  public:
+	using value_type = _Tp;
+	using is_always_equal = std::false_type;
+	using propagate_on_container_copy_assignment = std::true_type;
+	using propagate_on_container_move_assignment = std::true_type;
+	using propagate_on_container_swap = std::true_type;
+
+	template <typename _Up> struct rebind
+	{
+		using other = first_touch_allocator<_Up, _Align>;
+	};
+
+	constexpr first_touch_allocator() noexcept = default;
+	constexpr explicit first_touch_allocator(thread_pool &_p) noexcept : _pool(&_p) {}
+	template <typename _Up>
+	constexpr first_touch_allocator(const first_touch_allocator<_Up, _Align> &_other) noexcept : _pool(_other._pool)
+	{
+	}
+
+	inline thread_pool &
+	pool() const
+	{
+		return _pool != nullptr ? *_pool : default_pool();
+	}
+
+	[[nodiscard]] _Tp *
+	allocate(std::size_t _n)
+	{
+		void *_p = ::operator new(_n * sizeof(_Tp), std::align_val_t(_Align));
+		thread_pool &_on = pool();
+		if (_n * sizeof(_Tp) >= __first_touch_threshold && _on.placement() == thread_placement::numa)
+		{
+			__detail::__first_touch(_on, _p, _n * sizeof(_Tp));
+		}
+		return static_cast<_Tp *>(_p);
+	}
+	void
+	deallocate(_Tp *_p, std::size_t _n) noexcept
+	{
+		::operator delete(_p, _n * sizeof(_Tp), std::align_val_t(_Align));
+	}
+
+	template <typename _Up>
+	bool
+	operator==(const first_touch_allocator<_Up, _Align> &_other) const
+	{
+		return &pool() == &_other.pool();
+	}
+};
+
+// Bump allocator over one contiguous block. Allocation is a pointer
+// increment, deallocation is a no-op, and the whole block is recycled
+// with reset() (or partially with a scope). Running out of space throws
+// std::bad_alloc instead of falling back to the heap, so a pipeline
+// sized correctly is guaranteed to stay allocation free.
+class arena : public std::pmr::memory_resource
+{
+  private:
+	std::byte *_begin = nullptr;
+	std::size_t _capacity = 0;
+	std::size_t _offset = 0;
+	std::size_t _peak = 0;
+	std::pmr::memory_resource *_upstream = nullptr;
+
+  public:
+	// Position that can be rewound to, see scope
+	using marker = std::size_t;
+
+	// Restores the arena to where it was on construction, releasing the
+	// scratch an algorithm took for the duration of one call.
+	class scope
+	{
+	  private:
+		arena &_arena;
+		marker _mark;
+
+	  public:
+		explicit scope(arena &_a) : _arena(_a), _mark(_a.mark()) {}
+		scope(const scope &) = delete;
+		scope &operator=(const scope &) = delete;
+		~scope() { _arena.rewind(_mark); }
+	};
+
+	// Owns a block of _size bytes taken once from _from
+	explicit arena(std::size_t _size, std::pmr::memory_resource *_from = std::pmr::new_delete_resource())
+		: _begin(static_cast<std::byte *>(_from->allocate(_size, __default_alignment))), _capacity(_size),
+		  _upstream(_from)
+	{
+	}
+	// Uses caller provided storage (for example a static or stack buffer)
+	arena(void *_buffer, std::size_t _size) noexcept : _begin(static_cast<std::byte *>(_buffer)), _capacity(_size) {}
+	arena(const arena &) = delete;
+	arena &operator=(const arena &) = delete;
+	~arena() override
+	{
+		if (_upstream != nullptr)
+		{
+			_upstream->deallocate(_begin, _capacity, __default_alignment);
+		}
+	}
+
+	inline std::size_t
+	capacity() const noexcept
+	{
+		return _capacity;
+	}
+	inline std::size_t
+	used() const noexcept
+	{
+		return _offset;
+	}
+	// Largest used() seen since construction, for sizing the arena
+	inline std::size_t
+	high_water() const noexcept
+	{
+		return _peak;
+	}
+
+	inline marker
+	mark() const noexcept
+	{
+		return _offset;
+	}
+	inline void
+	rewind(marker _m) noexcept
+	{
+		_offset = _m;
+	}
+	inline void
+	reset() noexcept
+	{
+		_offset = 0;
+	}
+
+	// Uninitialized storage for _n objects of type _Tp
+	template <typename _Tp, std::size_t _Align = __default_alignment>
+	std::span<_Tp>
+	allocate_span(std::size_t _n)
+	{
+		constexpr std::size_t _alignment = _Align < alignof(_Tp) ? alignof(_Tp) : _Align;
+		return std::span<_Tp>(static_cast<_Tp *>(allocate(_n * sizeof(_Tp), _alignment)), _n);
+	}
+
+  protected:
+	void *
+	do_allocate(std::size_t _bytes, std::size_t _alignment) override
+	{
+		const std::uintptr_t _base = reinterpret_cast<std::uintptr_t>(_begin);
+		const std::uintptr_t _aligned = (_base + _offset + _alignment - 1) & ~(std::uintptr_t(_alignment) - 1);
+		const std::size_t _start = static_cast<std::size_t>(_aligned - _base);
+		if (_start > _capacity || _bytes > _capacity - _start)
+		{
+			throw std::bad_alloc();
+		}
+		_offset = _start + _bytes;
+		_peak = _offset > _peak ? _offset : _peak;
+		return _begin + _start;
+	}
+	void
+	do_deallocate(void *, std::size_t, std::size_t) override
+	{
+	}
+	bool
+	do_is_equal(const std::pmr::memory_resource &_other) const noexcept override
+	{
+		return this == &_other;
+	}
+};
+} // namespace hypercomplex
+#endif // MEMORY_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : memory.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,242 @@
+// header-begin ------------------------------------------
+// File       : numa.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      NUMA topology and thread placement for the thread
+//      pool and the first-touch allocator. The nodes and
+//      their CPUs come from libnuma when
+//      HYPERCOMPLEX_USE_LIBNUMA is defined (link -lnuma),
+//      otherwise from /sys/devices/system/node on Linux.
+//      Either way only the CPUs this process may run on are
+//      counted, and nodes without any are dropped. Anywhere
+//      else, or when neither source is readable, the machine
+//      is one node and pinning does nothing.
+//
+//      libnuma additionally lets memory be bound to a node
+//      explicitly; without it placement relies on the
+//      kernel's first-touch policy alone.
+//
+// header-end --------------------------------------------
+
+#ifndef NUMA_HPP
+#define NUMA_HPP
+
+#include <cstddef>
+#include <vector>
+
+#if defined(__linux__)
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#include <string>
+#include <unistd.h>
+#endif
+#if defined(HYPERCOMPLEX_USE_LIBNUMA)
+#include <numa.h>
+#endif
+
+namespace hypercomplex
+{
+class numa_topology
+{
+  private:
+	// CPUs of each node, all of them usable by this process, and the
+	// node's OS number
+	std::vector<std::vector<int>> _cpus;
+	std::vector<int> _ids;
+
+#if defined(__linux__)
+	// "0-3,8,10-11" -> {0, 1, 2, 3, 8, 10, 11}
+	static std::vector<int>
+	__parse_cpulist(const std::string &_list)
+	{
+		std::vector<int> _out;
+		std::size_t _pos = 0;
+		while (_pos < _list.size())
+		{
+			std::size_t _end = _list.find(',', _pos);
+			_end = _end == std::string::npos ? _list.size() : _end;
+			const std::string _item = _list.substr(_pos, _end - _pos);
+			const std::size_t _dash = _item.find('-');
+			if (!_item.empty() && _item[0] >= '0' && _item[0] <= '9')
+			{
+				const int _first = std::stoi(_item);
+				const int _last = _dash == std::string::npos ? _first : std::stoi(_item.substr(_dash + 1));
+				for (int _c = _first; _c <= _last; ++_c)
+				{
+					_out.push_back(_c);
+				}
+			}
+			_pos = _end + 1;
+		}
+		return _out;
+	}
+
+	void
+	__discover()
+	{
+		cpu_set_t _allowed;
+		CPU_ZERO(&_allowed);
+		if (sched_getaffinity(0, sizeof(_allowed), &_allowed) != 0)
+		{
+			return;
+		}
+#if defined(HYPERCOMPLEX_USE_LIBNUMA)
+		if (numa_available() >= 0)
+		{
+			bitmask *_mask = numa_allocate_cpumask();
+			for (int _node = 0; _node <= numa_max_node(); ++_node)
+			{
+				std::vector<int> _node_cpus;
+				if (numa_node_to_cpus(_node, _mask) == 0)
+				{
+					for (unsigned _c = 0; _c < _mask->size && _c < CPU_SETSIZE; ++_c)
+					{
+						if (numa_bitmask_isbitset(_mask, _c) && CPU_ISSET(_c, &_allowed))
+						{
+							_node_cpus.push_back(static_cast<int>(_c));
+						}
+					}
+				}
+				__add(_node, std::move(_node_cpus));
+			}
+			numa_free_cpumask(_mask);
+			return;
+		}
+#endif
+		for (int _node = 0;; ++_node)
+		{
+			std::ifstream _in("/sys/devices/system/node/node" + std::to_string(_node) + "/cpulist");
+			std::string _list;
+			if (!_in || !std::getline(_in, _list))
+			{
+				break;
+			}
+			std::vector<int> _node_cpus;
+			for (int _c : __parse_cpulist(_list))
+			{
+				if (_c < CPU_SETSIZE && CPU_ISSET(_c, &_allowed))
+				{
+					_node_cpus.push_back(_c);
+				}
+			}
+			__add(_node, std::move(_node_cpus));
+		}
+	}
+#endif
+
+	void
+	__add(int _node, std::vector<int> &&_node_cpus)
+	{
+		if (!_node_cpus.empty())
+		{
+			_ids.push_back(_node);
+			_cpus.push_back(std::move(_node_cpus));
+		}
+	}
+
+  public:
+	numa_topology()
+	{
+#if defined(__linux__)
+		__discover();
+#endif
+		if (_cpus.empty())
+		{
+			_ids.assign(1, 0);
+			_cpus.assign(1, std::vector<int>());
+		}
+	}
+
+	// Nodes with at least one usable CPU; always at least one
+	inline std::size_t
+	nodes() const noexcept
+	{
+		return _cpus.size();
+	}
+	// OS node number of node _i (0 <= _i < nodes())
+	inline int
+	id(std::size_t _i) const noexcept
+	{
+		return _ids[_i];
+	}
+	// Usable CPUs of node _i; empty when the topology is unknown
+	inline const std::vector<int> &
+	cpus(std::size_t _i) const noexcept
+	{
+		return _cpus[_i];
+	}
+
+	// Restricts the calling thread to the CPUs of node _i. Returns false
+	// (and changes nothing) where that is not supported.
+	bool
+	pin_current_thread(std::size_t _i) const
+	{
+#if defined(__linux__)
+		if (_cpus[_i].empty())
+		{
+			return false;
+		}
+		cpu_set_t _set;
+		CPU_ZERO(&_set);
+		for (int _c : _cpus[_i])
+		{
+			CPU_SET(_c, &_set);
+		}
+		return pthread_setaffinity_np(pthread_self(), sizeof(_set), &_set) == 0;
+#else
+		(void)_i;
+		return false;
+#endif
+	}
+
+	// Binds the pages of [_p, _p + _bytes) to node _i before they are
+	// first touched. Only libnuma can do this; returns false without it.
+	bool
+	bind_memory(void *_p, std::size_t _bytes, std::size_t _i) const
+	{
+#if defined(HYPERCOMPLEX_USE_LIBNUMA)
+		if (numa_available() >= 0 && nodes() > 1)
+		{
+			numa_tonode_memory(_p, _bytes, _ids[_i]);
+			return true;
+		}
+#endif
+		(void)_p;
+		(void)_bytes;
+		(void)_i;
+		return false;
+	}
+
+	// Granularity at which memory is placed on nodes
+	static std::size_t
+	page_size() noexcept
+	{
+#if defined(__linux__)
+		const long _size = sysconf(_SC_PAGESIZE);
+		return _size > 0 ? static_cast<std::size_t>(_size) : 4096;
+#else
+		return 4096;
+#endif
+	}
+
+	// Discovered once per process
+	static const numa_topology &
+	system()
+	{
+		static const numa_topology _topology;
+		return _topology;
+	}
+};
+} // namespace hypercomplex
+#endif // NUMA_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : numa.hpp
+// footer-end --------------------------------------------
@@ -6,11 +6,22 @@
 //
 // Created on  : 8/2/2025
 //
+// Comments:
+//      Octonions, the 8 dimensional Cayley-Dickson algebra.
+//      Multiplication is neither commutative nor
+//      associative, but it is alternative.
+//
 // header-end --------------------------------------------
 
 #ifndef OCTONION_HPP
 #define OCTONION_HPP
 
+#include "cayley_dickson.hpp"
+
+namespace hypercomplex
+{
+template <typename _UnderlyingType> using octonion = cayley_dickson<_UnderlyingType, 8>;
+} // namespace hypercomplex
 #endif // OCTONION_HPP
 
 // footer-begin ------------------------------------------
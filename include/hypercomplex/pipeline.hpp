@@ -0,0 +1,344 @@
+// header-begin ------------------------------------------
+// File       : pipeline.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Block streaming pipeline. Samples pushed into a
+//      pipeline are cut into cache-sized blocks that travel
+//      through every stage before the next block is
+//      touched, so a block is still in cache when the next
+//      stage reads it. Each stage runs on its own thread and
+//      hands blocks to the next one through two buffers, so
+//      neighbouring stages overlap; when both buffers are
+//      full the upstream stage (and finally push()) waits.
+//
+// header-end --------------------------------------------
+
+#ifndef PIPELINE_HPP
+#define PIPELINE_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hypercomplex
+{
+template <typename _UnderlyingType> class pipeline
+{
+  public:
+	using value_type = complex<_UnderlyingType>;
+	// Reads a block and writes its result, returning the number of
+	// samples written (at most out.size(), the block size)
+	using stage_type = std::function<std::size_t(std::span<const value_type>, std::span<value_type>)>;
+	using sink_type = std::function<void(std::span<const value_type>)>;
+
+	// Two blocks of this size per stage fit comfortably in a 256 KiB L2
+	static constexpr std::size_t default_block_bytes = 32768;
+
+  private:
+	static constexpr std::size_t __npos = static_cast<std::size_t>(-1);
+
+	// Two slots written in turn by one thread and read in the same order
+	// by another
+	struct __channel
+	{
+		std::mutex _mutex;
+		std::condition_variable _ready;
+		array<value_type> _slots[2];
+		std::size_t _sizes[2] = {0, 0};
+		std::size_t _read = 0, _write = 0, _count = 0;
+		bool _closed = false, _aborted = false;
+
+		explicit __channel(std::size_t _block) : _slots{array<value_type>(_block), array<value_type>(_block)} {}
+
+		// Index of a free slot, or __npos once the pipeline is aborted
+		std::size_t
+		__acquire_write()
+		{
+			std::unique_lock<std::mutex> _lock(_mutex);
+			_ready.wait(_lock, [this] { return _count < 2 || _aborted; });
+			return _aborted ? __npos : _write % 2;
+		}
+		void
+		__commit(std::size_t _slot, std::size_t _n)
+		{
+			{
+				std::lock_guard<std::mutex> _lock(_mutex);
+				_sizes[_slot] = _n;
+				++_write;
+				++_count;
+			}
+			_ready.notify_all();
+		}
+		// Index of the oldest full slot, or __npos at end of stream
+		std::size_t
+		__acquire_read()
+		{
+			std::unique_lock<std::mutex> _lock(_mutex);
+			_ready.wait(_lock, [this] { return _count > 0 || _closed || _aborted; });
+			return _aborted || _count == 0 ? __npos : _read % 2;
+		}
+		void
+		__release()
+		{
+			{
+				std::lock_guard<std::mutex> _lock(_mutex);
+				++_read;
+				--_count;
+			}
+			_ready.notify_all();
+		}
+		void
+		__close(bool _abort)
+		{
+			{
+				std::lock_guard<std::mutex> _lock(_mutex);
+				_closed = true;
+				_aborted = _aborted || _abort;
+			}
+			_ready.notify_all();
+		}
+	};
+
+	std::size_t _block;
+	std::vector<stage_type> _stages;
+	sink_type _sink;
+	// _channels[i] feeds _stages[i]
+	std::vector<std::unique_ptr<__channel>> _channels;
+	array<value_type> _last;
+	std::vector<std::thread> _threads;
+	std::mutex _error_mutex;
+	std::exception_ptr _error;
+
+	void
+	__fail()
+	{
+		{
+			std::lock_guard<std::mutex> _lock(_error_mutex);
+			if (!_error)
+			{
+				_error = std::current_exception();
+			}
+		}
+		for (auto &_c : _channels)
+		{
+			_c->__close(true);
+		}
+	}
+
+	void
+	__run(std::size_t _i)
+	{
+		__channel &_in = *_channels[_i];
+		__channel *_out = _i + 1 < _stages.size() ? _channels[_i + 1].get() : nullptr;
+		try
+		{
+			for (;;)
+			{
+				const std::size_t _r = _in.__acquire_read();
+				if (_r == __npos)
+				{
+					break;
+				}
+				const std::span<const value_type> _src(_in._slots[_r].data(), _in._sizes[_r]);
+				if (_out != nullptr)
+				{
+					const std::size_t _w = _out->__acquire_write();
+					if (_w == __npos)
+					{
+						break;
+					}
+					const std::size_t _n = _stages[_i](_src, std::span(_out->_slots[_w]));
+					assert(_n <= _block);
+					_out->__commit(_w, _n);
+				}
+				else
+				{
+					const std::size_t _n = _stages[_i](_src, std::span(_last));
+					assert(_n <= _block);
+					if (_sink)
+					{
+						_sink(std::span<const value_type>(_last.data(), _n));
+					}
+				}
+				_in.__release();
+			}
+			if (_out != nullptr)
+			{
+				_out->__close(false);
+			}
+		}
+		catch (...)
+		{
+			__fail();
+		}
+	}
+
+	void
+	__start()
+	{
+		if (_stages.empty())
+		{
+			// A pipeline without stages passes blocks straight to the sink
+			add_stage([](std::span<const value_type> _src, std::span<value_type> _dst)
+					  { return static_cast<std::size_t>(std::copy(_src.begin(), _src.end(), _dst.begin()) - _dst.begin()); });
+		}
+		for (std::size_t _i = 0; _i < _stages.size(); ++_i)
+		{
+			_channels.push_back(std::make_unique<__channel>(_block));
+		}
+		_last.resize(_block);
+		// Stage threads live as long as the stream, so they are not taken
+		// from the thread pool, whose workers serve short parallel loops
+		for (std::size_t _i = 0; _i < _stages.size(); ++_i)
+		{
+			_threads.emplace_back([this, _i] { __run(_i); });
+		}
+	}
+
+	void
+	__join()
+	{
+		for (auto &_t : _threads)
+		{
+			_t.join();
+		}
+		_threads.clear();
+	}
+
+  public:
+	explicit pipeline(std::size_t _block_size = default_block_bytes / sizeof(value_type))
+		: _block(std::max<std::size_t>(_block_size, 1))
+	{
+	}
+	pipeline(const pipeline &) = delete;
+	pipeline &operator=(const pipeline &) = delete;
+	~pipeline()
+	{
+		if (!_threads.empty())
+		{
+			for (auto &_c : _channels)
+			{
+				_c->__close(true);
+			}
+			__join();
+		}
+	}
+
+	inline std::size_t
+	block_size() const noexcept
+	{
+		return _block;
+	}
+
+	// Appends a stage. Stages returning void write out.size() ==
+	// in.size() samples. Must be called before the first push().
+	template <typename _Stage>
+	pipeline &
+	add_stage(_Stage &&_stage)
+	{
+		assert(_channels.empty());
+		using _Result = std::invoke_result_t<_Stage &, std::span<const value_type>, std::span<value_type>>;
+		if constexpr (std::is_void_v<_Result>)
+		{
+			_stages.emplace_back(
+				[_fn = std::forward<_Stage>(_stage)](std::span<const value_type> _src,
+													 std::span<value_type> _dst) mutable -> std::size_t
+				{
+					_fn(_src, _dst.first(_src.size()));
+					return _src.size();
+				});
+		}
+		else
+		{
+			_stages.emplace_back(std::forward<_Stage>(_stage));
+		}
+		return *this;
+	}
+
+	// Receives the output of the last stage, on that stage's thread
+	pipeline &
+	set_sink(sink_type _fn)
+	{
+		assert(_channels.empty());
+		_sink = std::move(_fn);
+		return *this;
+	}
+
+	// Queues _n samples as blocks of at most block_size(), blocking while
+	// the first stage is two blocks behind. Rethrows the first exception
+	// thrown by a stage.
+	void
+	push(const value_type *_data, std::size_t _n)
+	{
+		if (_channels.empty())
+		{
+			__start();
+		}
+		__channel &_in = *_channels.front();
+		while (_n != 0)
+		{
+			const std::size_t _w = _in.__acquire_write();
+			if (_w == __npos)
+			{
+				break;
+			}
+			const std::size_t _c = std::min(_n, _block);
+			std::copy_n(_data, _c, _in._slots[_w].data());
+			_in.__commit(_w, _c);
+			_data += _c;
+			_n -= _c;
+		}
+		std::lock_guard<std::mutex> _lock(_error_mutex);
+		if (_error)
+		{
+			std::rethrow_exception(_error);
+		}
+	}
+	void
+	push(std::span<const value_type> _data)
+	{
+		push(_data.data(), _data.size());
+	}
+
+	// Ends the stream and waits until every queued block has reached the
+	// sink. The pipeline cannot be pushed to afterwards.
+	void
+	finish()
+	{
+		if (_channels.empty())
+		{
+			__start();
+		}
+		_channels.front()->__close(false);
+		__join();
+		if (_error)
+		{
+			std::rethrow_exception(_error);
+		}
+	}
+};
+} // namespace hypercomplex
+#endif // PIPELINE_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : pipeline.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,587 @@
+// header-begin ------------------------------------------
+// File       : qr.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Householder QR, A = Q R, of an m x n complex matrix with
+//      m >= n, and the least-squares solve built on it. Q is
+//      never formed; it is kept as the reflectors
+//      H = I - tau v v^H below the diagonal of the factored
+//      matrix, as LAPACK does. Panels of __block columns are
+//      applied to the trailing matrix at once through the
+//      compact WY form I - V T V^H.
+//
+//      Tall-skinny matrices use TSQR: the rows are cut into
+//      leaves of a fixed size, each leaf is factored on its
+//      own (in parallel, and in cache), and the stacked leaf
+//      R factors are factored once more. A pass over the
+//      full matrix is then made once per leaf instead of
+//      once per panel.
+//
+//      Factoring takes its trailing-update scratch once per
+//      matrix rather than once per panel. The solves take
+//      theirs from a std::pmr::memory_resource, so a caller
+//      solving repeatedly can hand them an arena sized with
+//      scratch_size() and do no heap allocation per call.
+//
+// header-end --------------------------------------------
+
+#ifndef QR_HPP
+#define QR_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <memory_resource>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace hypercomplex
+{
+enum class qr_method
+{
+	automatic,
+	householder,
+	tsqr
+};
+
+namespace __detail
+{
+// Blocked Householder QR of one matrix, stored in place
+template <typename _UnderlyingType> class __householder_qr
+{
+  public:
+	using _ComplexType = complex<_UnderlyingType>;
+
+	// Panel width; T and the panel rows of V^H A are __block wide
+	static constexpr std::size_t __block = 32;
+
+	// R on and above the diagonal, v_j below it (v_j has an implicit
+	// 1 at row j)
+	matrix<_ComplexType> _a;
+	array<_ComplexType> _tau;
+
+	__householder_qr() = default;
+	explicit __householder_qr(matrix<_ComplexType> &&_m) : _a(std::move(_m)), _tau(_a.cols()) {}
+
+	// v_j at row _i, including the implicit one and the zeros above it
+	_ComplexType
+	__v(std::size_t _i, std::size_t _j) const
+	{
+		return _i > _j ? _a(_i, _j) : _ComplexType(_i == _j ? _UnderlyingType(1) : _UnderlyingType(0));
+	}
+
+	// Turns column _j into beta e_j (LAPACK zlarfg, without rescaling)
+	void
+	__reflector(std::size_t _j)
+	{
+		const std::size_t _m = _a.rows();
+		_UnderlyingType _ss = 0;
+		for (std::size_t _i = _j + 1; _i < _m; ++_i)
+		{
+			_ss += norm(_a(_i, _j));
+		}
+		const _ComplexType _alpha = _a(_j, _j);
+		if (_ss == _UnderlyingType(0) && _alpha.imag() == _UnderlyingType(0))
+		{
+			_tau[_j] = _ComplexType();
+			return;
+		}
+		const _UnderlyingType _beta
+			= -std::copysign(std::sqrt(norm(_alpha) + _ss), _alpha.real());
+		_tau[_j] = _ComplexType((_beta - _alpha.real()) / _beta, -_alpha.imag() / _beta);
+		const _ComplexType _scale = _ComplexType(1) / (_alpha - _ComplexType(_beta));
+		for (std::size_t _i = _j + 1; _i < _m; ++_i)
+		{
+			_a(_i, _j) = _a(_i, _j) * _scale;
+		}
+		_a(_j, _j) = _ComplexType(_beta);
+	}
+
+	// Unblocked factorization of columns [_k, _k + _w)
+	void
+	__factor_panel(std::size_t _k, std::size_t _w)
+	{
+		const std::size_t _m = _a.rows();
+		_ComplexType _work[__block];
+		for (std::size_t _j = _k; _j < _k + _w; ++_j)
+		{
+			__reflector(_j);
+			const std::size_t _c0 = _j + 1, _c1 = _k + _w;
+			if (_c0 == _c1 || _tau[_j] == _ComplexType())
+			{
+				continue;
+			}
+			// A := (I - conj(tau) v v^H) A on the rest of the panel
+			for (std::size_t _c = _c0; _c < _c1; ++_c)
+			{
+				_work[_c - _c0] = _a(_j, _c);
+			}
+			for (std::size_t _i = _j + 1; _i < _m; ++_i)
+			{
+				const _ComplexType _v = conj(_a(_i, _j));
+				for (std::size_t _c = _c0; _c < _c1; ++_c)
+				{
+					_work[_c - _c0] += _v * _a(_i, _c);
+				}
+			}
+			const _ComplexType _ct = conj(_tau[_j]);
+			for (std::size_t _c = _c0; _c < _c1; ++_c)
+			{
+				_work[_c - _c0] = _ct * _work[_c - _c0];
+				_a(_j, _c) -= _work[_c - _c0];
+			}
+			for (std::size_t _i = _j + 1; _i < _m; ++_i)
+			{
+				const _ComplexType _v = _a(_i, _j);
+				for (std::size_t _c = _c0; _c < _c1; ++_c)
+				{
+					_a(_i, _c) -= _v * _work[_c - _c0];
+				}
+			}
+		}
+	}
+
+	// Upper triangular T of the panel's compact WY form (LAPACK zlarft,
+	// forward and columnwise), from G = V^H V gathered in one pass
+	void
+	__triangular_factor(std::size_t _k, std::size_t _w, _ComplexType (&_t)[__block][__block]) const
+	{
+		_ComplexType _g[__block][__block] = {};
+		for (std::size_t _i = _k; _i < _a.rows(); ++_i)
+		{
+			for (std::size_t _l = 0; _l < _w; ++_l)
+			{
+				const _ComplexType _vl = conj(__v(_i, _k + _l));
+				for (std::size_t _j = _l + 1; _j < _w; ++_j)
+				{
+					_g[_l][_j] += _vl * __v(_i, _k + _j);
+				}
+			}
+		}
+		for (std::size_t _j = 0; _j < _w; ++_j)
+		{
+			const _ComplexType _tj = _tau[_k + _j];
+			for (std::size_t _l = 0; _l < _j; ++_l)
+			{
+				_ComplexType _s;
+				for (std::size_t _p = _l; _p < _j; ++_p)
+				{
+					_s += _t[_l][_p] * _g[_p][_j];
+				}
+				_t[_l][_j] = -_tj * _s;
+			}
+			_t[_j][_j] = _tj;
+			for (std::size_t _l = _j + 1; _l < __block; ++_l)
+			{
+				_t[_l][_j] = _ComplexType();
+			}
+		}
+	}
+
+	// A2 := (I - V T V^H)^H A2 = A2 - V T^H (V^H A2) for the columns
+	// right of the panel; _scratch holds at least _w x (n - _k - _w)
+	template <typename _Policy>
+	void
+	__update_trailing(const _Policy &_policy, std::size_t _k, std::size_t _w, const _ComplexType (&_t)[__block][__block],
+					  _ComplexType *_scratch)
+	{
+		const std::size_t _m = _a.rows(), _n = _a.cols();
+		const std::size_t _c0 = _k + _w, _cols = _n - _c0;
+		std::fill_n(_scratch, _w * _cols, _ComplexType());
+		auto _work = [_scratch, _cols](std::size_t _l, std::size_t _c) -> _ComplexType &
+		{
+			return _scratch[_l * _cols + _c];
+		};
+		// W = V^H A2, split over columns
+		__for_each_chunk(
+			_policy, _cols,
+			[&](std::size_t _begin, std::size_t _end)
+			{
+				for (std::size_t _i = _k; _i < _m; ++_i)
+				{
+					for (std::size_t _l = 0; _l < _w && _l + _k <= _i; ++_l)
+					{
+						const _ComplexType _v = conj(__v(_i, _k + _l));
+						for (std::size_t _c = _begin; _c < _end; ++_c)
+						{
+							_work(_l, _c) += _v * _a(_i, _c0 + _c);
+						}
+					}
+				}
+			},
+			std::max<std::size_t>(1, __default_grain / (_m - _k)));
+		// W = T^H W, bottom row first so W can be overwritten
+		for (std::size_t _l = _w; _l-- > 0;)
+		{
+			for (std::size_t _c = 0; _c < _cols; ++_c)
+			{
+				_ComplexType _s;
+				for (std::size_t _p = 0; _p <= _l; ++_p)
+				{
+					_s += conj(_t[_p][_l]) * _work(_p, _c);
+				}
+				_work(_l, _c) = _s;
+			}
+		}
+		// A2 -= V W, split over rows
+		__for_each_chunk(
+			_policy, _m - _k,
+			[&](std::size_t _begin, std::size_t _end)
+			{
+				for (std::size_t _i = _k + _begin; _i < _k + _end; ++_i)
+				{
+					for (std::size_t _l = 0; _l < _w && _l + _k <= _i; ++_l)
+					{
+						const _ComplexType _v = __v(_i, _k + _l);
+						for (std::size_t _c = 0; _c < _cols; ++_c)
+						{
+							_a(_i, _c0 + _c) -= _v * _work(_l, _c);
+						}
+					}
+				}
+			},
+			std::max<std::size_t>(1, __default_grain / (_w * _cols + 1)));
+	}
+
+	template <typename _Policy>
+	void
+	factor(const _Policy &_policy)
+	{
+		const std::size_t _n = _a.cols();
+		_ComplexType _t[__block][__block];
+		// Sized for the first panel, whose trailing matrix is the widest
+		const std::size_t _first = std::min(__block, _n);
+		array<_ComplexType> _scratch(_first * (_n - _first));
+		for (std::size_t _k = 0; _k < _n; _k += __block)
+		{
+			const std::size_t _w = std::min(__block, _n - _k);
+			__factor_panel(_k, _w);
+			if (_k + _w < _n)
+			{
+				__triangular_factor(_k, _w, _t);
+				__update_trailing(_policy, _k, _w, _t, _scratch.data());
+			}
+		}
+	}
+
+	// _b := Q^H _b for the m x _k row-major block at _b (row stride _ld),
+	// using _w (_k elements) as scratch
+	void
+	apply_qh(_ComplexType *_b, std::size_t _ld, std::size_t _k, _ComplexType *_w) const
+	{
+		const std::size_t _m = _a.rows();
+		for (std::size_t _j = 0; _j < _a.cols(); ++_j)
+		{
+			if (_tau[_j] == _ComplexType())
+			{
+				continue;
+			}
+			for (std::size_t _c = 0; _c < _k; ++_c)
+			{
+				_w[_c] = _b[_j * _ld + _c];
+			}
+			for (std::size_t _i = _j + 1; _i < _m; ++_i)
+			{
+				const _ComplexType _v = conj(_a(_i, _j));
+				for (std::size_t _c = 0; _c < _k; ++_c)
+				{
+					_w[_c] += _v * _b[_i * _ld + _c];
+				}
+			}
+			const _ComplexType _ct = conj(_tau[_j]);
+			for (std::size_t _c = 0; _c < _k; ++_c)
+			{
+				_w[_c] = _ct * _w[_c];
+				_b[_j * _ld + _c] -= _w[_c];
+			}
+			for (std::size_t _i = _j + 1; _i < _m; ++_i)
+			{
+				const _ComplexType _v = _a(_i, _j);
+				for (std::size_t _c = 0; _c < _k; ++_c)
+				{
+					_b[_i * _ld + _c] -= _v * _w[_c];
+				}
+			}
+		}
+	}
+};
+} // namespace __detail
+
+template <typename _UnderlyingType> class qr_decomposition
+{
+  public:
+	// Rows per TSQR leaf (at least 2n); a 1024 x 64 double leaf is 1 MiB
+	static constexpr std::size_t leaf_rows = 1024;
+
+  private:
+	using _ComplexType = complex<_UnderlyingType>;
+	using _Factor = __detail::__householder_qr<_UnderlyingType>;
+
+	std::size_t _rows = 0, _cols = 0;
+	// One leaf for plain Householder; otherwise the leaves cover rows
+	// [_offsets[i], _offsets[i + 1]) and _top factors their stacked R
+	std::vector<_Factor> _leaves;
+	std::vector<std::size_t> _offsets;
+	_Factor _top;
+	bool _rank_deficient = false;
+
+	const _Factor &
+	__root() const
+	{
+		return _leaves.size() == 1 ? _leaves[0] : _top;
+	}
+
+	// Q^H applied to the m x _k block _b (row stride _ld); the first n
+	// rows of the result are written to _c (row stride _k)
+	template <typename _Policy>
+	void
+	__apply_qh(const _Policy &_policy, _ComplexType *_b, std::size_t _ld, std::size_t _k, _ComplexType *_c,
+			   std::pmr::memory_resource *_scratch) const
+	{
+		const std::size_t _n = _cols;
+		// One row of reflector scratch per leaf, as the leaves run at once
+		pmr::array<_ComplexType> _w(_leaves.size() * _k, _scratch);
+		if (_leaves.size() == 1)
+		{
+			_leaves[0].apply_qh(_b, _ld, _k, _w.data());
+			for (std::size_t _i = 0; _i < _n; ++_i)
+			{
+				std::copy_n(_b + _i * _ld, _k, _c + _i * _k);
+			}
+			return;
+		}
+		pmr::matrix<_ComplexType> _stacked(_leaves.size() * _n, _k, _scratch);
+		__detail::__for_each_chunk(
+			_policy, _leaves.size(),
+			[&](std::size_t _begin, std::size_t _end)
+			{
+				for (std::size_t _l = _begin; _l < _end; ++_l)
+				{
+					_ComplexType *_part = _b + _offsets[_l] * _ld;
+					_leaves[_l].apply_qh(_part, _ld, _k, _w.data() + _l * _k);
+					for (std::size_t _i = 0; _i < _n; ++_i)
+					{
+						std::copy_n(_part + _i * _ld, _k, _stacked.data() + (_l * _n + _i) * _k);
+					}
+				}
+			},
+			1);
+		_top.apply_qh(_stacked.data(), _k, _k, _w.data());
+		std::copy_n(_stacked.data(), _n * _k, _c);
+	}
+
+	// Solves R X = _c in place, _c being n x _k
+	void
+	__back_substitute(_ComplexType *_c, std::size_t _k) const
+	{
+		const matrix<_ComplexType> &_r = __root()._a;
+		for (std::size_t _i = _cols; _i-- > 0;)
+		{
+			for (std::size_t _j = _i + 1; _j < _cols; ++_j)
+			{
+				const _ComplexType _rij = _r(_i, _j);
+				for (std::size_t _col = 0; _col < _k; ++_col)
+				{
+					_c[_i * _k + _col] -= _rij * _c[_j * _k + _col];
+				}
+			}
+			const _ComplexType _inverse = _ComplexType(1) / _r(_i, _i);
+			for (std::size_t _col = 0; _col < _k; ++_col)
+			{
+				_c[_i * _k + _col] = _c[_i * _k + _col] * _inverse;
+			}
+		}
+	}
+
+	void
+	__check_solvable(std::size_t _b_rows) const
+	{
+		if (_rank_deficient)
+		{
+			throw std::invalid_argument("qr_decomposition: matrix does not have full column rank");
+		}
+		if (_b_rows != _rows)
+		{
+			throw std::invalid_argument("qr_decomposition: right-hand side has the wrong size");
+		}
+	}
+
+  public:
+	qr_decomposition() = default;
+	// Throws std::invalid_argument unless rows >= cols > 0
+	template <execution::execution_policy _Policy, typename _Alloc>
+	qr_decomposition(const _Policy &_policy, const matrix<_ComplexType, _Alloc> &_a,
+					 qr_method _method = qr_method::automatic)
+		: _rows(_a.rows()), _cols(_a.cols())
+	{
+		if (_cols == 0 || _rows < _cols)
+		{
+			throw std::invalid_argument("qr_decomposition: matrix must have at least as many rows as columns");
+		}
+		const std::size_t _leaf = std::max(leaf_rows, 2 * _cols);
+		const std::size_t _count = _method == qr_method::householder ? 1
+								   : _method == qr_method::tsqr		 ? std::max<std::size_t>(1, _rows / _leaf)
+								   : _rows >= 2 * _leaf				 ? _rows / _leaf
+																	 : 1;
+		_offsets.resize(_count + 1);
+		for (std::size_t _l = 0; _l <= _count; ++_l)
+		{
+			_offsets[_l] = _rows * _l / _count;
+		}
+		_leaves.resize(_count);
+		__detail::__for_each_chunk(
+			_policy, _count,
+			[&](std::size_t _begin, std::size_t _end)
+			{
+				for (std::size_t _l = _begin; _l < _end; ++_l)
+				{
+					const std::size_t _r0 = _offsets[_l], _r1 = _offsets[_l + 1];
+					matrix<_ComplexType> _block(_r1 - _r0, _cols);
+					std::copy(_a.data() + _r0 * _a.stride(), _a.data() + _r1 * _a.stride(), _block.data());
+					_leaves[_l] = _Factor(std::move(_block));
+					if (_count == 1)
+					{
+						_leaves[_l].factor(_policy);
+					}
+					else
+					{
+						_leaves[_l].factor(execution::seq);
+					}
+				}
+			},
+			1);
+
+		if (_count > 1)
+		{
+			matrix<_ComplexType> _stacked(_count * _cols, _cols);
+			for (std::size_t _l = 0; _l < _count; ++_l)
+			{
+				for (std::size_t _i = 0; _i < _cols; ++_i)
+				{
+					for (std::size_t _j = _i; _j < _cols; ++_j)
+					{
+						_stacked(_l * _cols + _i, _j) = _leaves[_l]._a(_i, _j);
+					}
+				}
+			}
+			_top = _Factor(std::move(_stacked));
+			_top.factor(_policy);
+		}
+		for (std::size_t _i = 0; _i < _cols; ++_i)
+		{
+			_rank_deficient |= __root()._a(_i, _i) == _ComplexType();
+		}
+	}
+	template <typename _Alloc>
+	explicit qr_decomposition(const matrix<_ComplexType, _Alloc> &_a, qr_method _method = qr_method::automatic)
+		: qr_decomposition(execution::seq, _a, _method)
+	{
+	}
+
+	inline std::size_t
+	rows() const noexcept
+	{
+		return _rows;
+	}
+	inline std::size_t
+	cols() const noexcept
+	{
+		return _cols;
+	}
+	// Number of TSQR leaves, 1 for plain Householder
+	inline std::size_t
+	leaves() const noexcept
+	{
+		return _leaves.size();
+	}
+	inline bool
+	rank_deficient() const noexcept
+	{
+		return _rank_deficient;
+	}
+	// The n x n upper triangular factor
+	matrix<_ComplexType>
+	r() const
+	{
+		matrix<_ComplexType> _r(_cols, _cols);
+		for (std::size_t _i = 0; _i < _cols; ++_i)
+		{
+			for (std::size_t _j = _i; _j < _cols; ++_j)
+			{
+				_r(_i, _j) = __root()._a(_i, _j);
+			}
+		}
+		return _r;
+	}
+
+	// Bytes of scratch a solve with _k right-hand sides takes from its
+	// memory_resource, alignment padding included
+	std::size_t
+	scratch_size(std::size_t _k = 1) const noexcept
+	{
+		const std::size_t _elements = _rows * _k + (_leaves.size() > 1 ? _leaves.size() * _cols * _k : 0)
+									  + _leaves.size() * _k;
+		return _elements * sizeof(_ComplexType) + 3 * alignof(_ComplexType);
+	}
+
+	// x minimizing |A x - _b|, for the m-vector _b and n-vector _x. The
+	// working copy of _b comes from _scratch.
+	template <execution::execution_policy _Policy>
+	void
+	solve(const _Policy &_policy, std::span<const _ComplexType> _b, std::span<_ComplexType> _x,
+		  std::pmr::memory_resource *_scratch = std::pmr::get_default_resource()) const
+	{
+		__check_solvable(_b.size());
+		assert(_x.size() >= _cols);
+		pmr::array<_ComplexType> _work(_b.size(), _scratch);
+		std::copy(_b.begin(), _b.end(), _work.begin());
+		__apply_qh(_policy, _work.data(), 1, 1, _x.data(), _scratch);
+		__back_substitute(_x.data(), 1);
+	}
+	void
+	solve(std::span<const _ComplexType> _b, std::span<_ComplexType> _x,
+		  std::pmr::memory_resource *_scratch = std::pmr::get_default_resource()) const
+	{
+		solve(execution::seq, _b, _x, _scratch);
+	}
+	// Least-squares solution for every column of the m x k matrix _b,
+	// returned as an n x k matrix
+	template <execution::execution_policy _Policy, typename _Alloc>
+	matrix<_ComplexType>
+	solve_many(const _Policy &_policy, const matrix<_ComplexType, _Alloc> &_b,
+			   std::pmr::memory_resource *_scratch = std::pmr::get_default_resource()) const
+	{
+		__check_solvable(_b.rows());
+		pmr::matrix<_ComplexType> _work(_b.rows(), _b.cols(), _scratch);
+		std::copy(_b.begin(), _b.end(), _work.begin());
+		matrix<_ComplexType> _x(_cols, _b.cols());
+		__apply_qh(_policy, _work.data(), _work.stride(), _b.cols(), _x.data(), _scratch);
+		__back_substitute(_x.data(), _b.cols());
+		return _x;
+	}
+	template <typename _Alloc>
+	matrix<_ComplexType>
+	solve_many(const matrix<_ComplexType, _Alloc> &_b,
+			   std::pmr::memory_resource *_scratch = std::pmr::get_default_resource()) const
+	{
+		return solve_many(execution::seq, _b, _scratch);
+	}
+};
+} // namespace hypercomplex
+#endif // QR_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : qr.hpp
+// footer-end --------------------------------------------
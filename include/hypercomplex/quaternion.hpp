@@ -6,14 +6,280 @@
 //
 // Created on  : 8/2/2025
 //
+// Comments:
+//      Quaternions q = w + x*i + y*j + z*k with
+//      i^2 = j^2 = k^2 = ijk = -1. Multiplication is
+//      associative but not commutative. Unit quaternions
+//      represent rotations; see orientation.hpp for the
+//      batch integrators built on them.
+//
 // header-end --------------------------------------------
 
 #ifndef QUATERNION_HPP
 #define QUATERNION_HPP
 
+#include <cmath>
+#include <ostream>
+#include <type_traits>
+
+namespace hypercomplex
+{
+// Class Forward Decleration
+template <typename _UnderlyingType> class quaternion;
+
+// Mathematical Functions
+template <typename _UnderlyingType> constexpr _UnderlyingType norm(const quaternion<_UnderlyingType> &);
+template <typename _UnderlyingType> _UnderlyingType abs(const quaternion<_UnderlyingType> &);
+template <typename _UnderlyingType> constexpr quaternion<_UnderlyingType> conj(const quaternion<_UnderlyingType> &);
+template <typename _UnderlyingType> constexpr quaternion<_UnderlyingType> inverse(const quaternion<_UnderlyingType> &);
+template <typename _UnderlyingType> quaternion<_UnderlyingType> normalize(const quaternion<_UnderlyingType> &);
+template <typename _UnderlyingType> quaternion<_UnderlyingType> exp(const quaternion<_UnderlyingType> &);
+template <typename _UnderlyingType> quaternion<_UnderlyingType> log(const quaternion<_UnderlyingType> &);
+
+template <typename _UnderlyingType> class quaternion
+{
+	static_assert(std::is_floating_point<_UnderlyingType>::value, "_UnderlyingType must be a floating-point type");
+
+  private:
+	// q = _w + i * _x + j * _y + k * _z
+	_UnderlyingType _w, _x, _y, _z;
+
+  public:
+	constexpr quaternion(const _UnderlyingType &_a = _UnderlyingType(), const _UnderlyingType &_b = _UnderlyingType(),
+						 const _UnderlyingType &_c = _UnderlyingType(), const _UnderlyingType &_d = _UnderlyingType())
+		: _w(_a), _x(_b), _y(_c), _z(_d)
+	{
+	}
+	constexpr quaternion(const quaternion &) = default;
+	template <class type>
+	constexpr quaternion(const quaternion<type> &_q)
+		: _w(static_cast<_UnderlyingType>(_q.w())), _x(static_cast<_UnderlyingType>(_q.x())),
+		  _y(static_cast<_UnderlyingType>(_q.y())), _z(static_cast<_UnderlyingType>(_q.z()))
+	{
+	}
+
+	inline constexpr _UnderlyingType
+	w() const
+	{
+		return _w;
+	}
+	inline constexpr void
+	w(_UnderlyingType _val)
+	{
+		_w = _val;
+	}
+	inline constexpr _UnderlyingType
+	x() const
+	{
+		return _x;
+	}
+	inline constexpr void
+	x(_UnderlyingType _val)
+	{
+		_x = _val;
+	}
+	inline constexpr _UnderlyingType
+	y() const
+	{
+		return _y;
+	}
+	inline constexpr void
+	y(_UnderlyingType _val)
+	{
+		_y = _val;
+	}
+	inline constexpr _UnderlyingType
+	z() const
+	{
+		return _z;
+	}
+	inline constexpr void
+	z(_UnderlyingType _val)
+	{
+		_z = _val;
+	}
+
+	constexpr quaternion &operator=(const quaternion &rhs) = default;
+	inline constexpr quaternion &
+	operator+=(const quaternion &rhs)
+	{
+		_w += rhs._w;
+		_x += rhs._x;
+		_y += rhs._y;
+		_z += rhs._z;
+		return *this;
+	}
+	inline constexpr quaternion &
+	operator-=(const quaternion &rhs)
+	{
+		_w -= rhs._w;
+		_x -= rhs._x;
+		_y -= rhs._y;
+		_z -= rhs._z;
+		return *this;
+	}
+	// Hamilton product, *this = *this * rhs
+	inline constexpr quaternion &
+	operator*=(const quaternion &rhs)
+	{
+		const _UnderlyingType _a = _w * rhs._w - _x * rhs._x - _y * rhs._y - _z * rhs._z;
+		const _UnderlyingType _b = _w * rhs._x + _x * rhs._w + _y * rhs._z - _z * rhs._y;
+		const _UnderlyingType _c = _w * rhs._y - _x * rhs._z + _y * rhs._w + _z * rhs._x;
+		const _UnderlyingType _d = _w * rhs._z + _x * rhs._y - _y * rhs._x + _z * rhs._w;
+		_w = _a;
+		_x = _b;
+		_y = _c;
+		_z = _d;
+		return *this;
+	}
+	inline constexpr quaternion &
+	operator*=(const _UnderlyingType &rhs)
+	{
+		_w *= rhs;
+		_x *= rhs;
+		_y *= rhs;
+		_z *= rhs;
+		return *this;
+	}
+	inline constexpr quaternion &
+	operator/=(const _UnderlyingType &rhs)
+	{
+		_w /= rhs;
+		_x /= rhs;
+		_y /= rhs;
+		_z /= rhs;
+		return *this;
+	}
+};
+
+// Arithmetic Operators
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator+(const quaternion<_UnderlyingType> &lhs, const quaternion<_UnderlyingType> &rhs)
+{
+	quaternion<_UnderlyingType> _r = lhs;
+	return _r += rhs;
+}
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator-(const quaternion<_UnderlyingType> &lhs, const quaternion<_UnderlyingType> &rhs)
+{
+	quaternion<_UnderlyingType> _r = lhs;
+	return _r -= rhs;
+}
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator*(const quaternion<_UnderlyingType> &lhs, const quaternion<_UnderlyingType> &rhs)
+{
+	quaternion<_UnderlyingType> _r = lhs;
+	return _r *= rhs;
+}
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator*(const quaternion<_UnderlyingType> &lhs, const _UnderlyingType &rhs)
+{
+	quaternion<_UnderlyingType> _r = lhs;
+	return _r *= rhs;
+}
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator*(const _UnderlyingType &lhs, const quaternion<_UnderlyingType> &rhs)
+{
+	quaternion<_UnderlyingType> _r = rhs;
+	return _r *= lhs;
+}
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator/(const quaternion<_UnderlyingType> &lhs, const _UnderlyingType &rhs)
+{
+	quaternion<_UnderlyingType> _r = lhs;
+	return _r /= rhs;
+}
+template <typename _UnderlyingType>
+inline constexpr quaternion<_UnderlyingType>
+operator-(const quaternion<_UnderlyingType> &_q)
+{
+	return quaternion<_UnderlyingType>(-_q.w(), -_q.x(), -_q.y(), -_q.z());
+}
+
+// Equality Operators
+template <typename _UnderlyingType>
+inline constexpr bool
+operator==(const quaternion<_UnderlyingType> &lhs, const quaternion<_UnderlyingType> &rhs)
+{
+	return lhs.w() == rhs.w() && lhs.x() == rhs.x() && lhs.y() == rhs.y() && lhs.z() == rhs.z();
+}
+
+// Streaming Operators
+template <class _UnderlyingType, class charT, class traits>
+std::basic_ostream<charT, traits> &
+operator<<(std::basic_ostream<charT, traits> &o, const quaternion<_UnderlyingType> &rhs)
+{
+	o << "(" << rhs.w() << "," << rhs.x() << "," << rhs.y() << "," << rhs.z() << ")";
+	return o;
+}
+
+// Mathematical Functions
+template <typename _UnderlyingType>
+constexpr _UnderlyingType
+norm(const quaternion<_UnderlyingType> &_q)
+{
+	return _q.w() * _q.w() + _q.x() * _q.x() + _q.y() * _q.y() + _q.z() * _q.z();
+}
+template <typename _UnderlyingType>
+_UnderlyingType
+abs(const quaternion<_UnderlyingType> &_q)
+{
+	return std::hypot(std::hypot(_q.w(), _q.x()), std::hypot(_q.y(), _q.z()));
+}
+template <typename _UnderlyingType>
+constexpr quaternion<_UnderlyingType>
+conj(const quaternion<_UnderlyingType> &_q)
+{
+	return quaternion<_UnderlyingType>(_q.w(), -_q.x(), -_q.y(), -_q.z());
+}
+template <typename _UnderlyingType>
+constexpr quaternion<_UnderlyingType>
+inverse(const quaternion<_UnderlyingType> &_q)
+{
+	return conj(_q) / norm(_q);
+}
+template <typename _UnderlyingType>
+quaternion<_UnderlyingType>
+normalize(const quaternion<_UnderlyingType> &_q)
+{
+	return _q / abs(_q);
+}
+
+// exp(w + v) = e^w * (cos|v| + v/|v| * sin|v|). sin(t)/t is taken from
+// its series near zero so that a pure real argument stays exact.
+template <typename _UnderlyingType>
+quaternion<_UnderlyingType>
+exp(const quaternion<_UnderlyingType> &_q)
+{
+	const _UnderlyingType _t = std::sqrt(_q.x() * _q.x() + _q.y() * _q.y() + _q.z() * _q.z());
+	const _UnderlyingType _e = std::exp(_q.w());
+	const _UnderlyingType _t2 = _t * _t;
+	const _UnderlyingType _sinc = _t < _UnderlyingType(1e-4L)
+									  ? _UnderlyingType(1) - _t2 * (_UnderlyingType(1.0L / 6) - _t2 / _UnderlyingType(120))
+									  : std::sin(_t) / _t;
+	const _UnderlyingType _s = _e * _sinc;
+	return quaternion<_UnderlyingType>(_e * std::cos(_t), _s * _q.x(), _s * _q.y(), _s * _q.z());
+}
+// log(q) = ln|q| + v/|v| * atan2(|v|, w); a pure real q maps to (ln|q|, 0).
+template <typename _UnderlyingType>
+quaternion<_UnderlyingType>
+log(const quaternion<_UnderlyingType> &_q)
+{
+	const _UnderlyingType _v = std::sqrt(_q.x() * _q.x() + _q.y() * _q.y() + _q.z() * _q.z());
+	const _UnderlyingType _theta = std::atan2(_v, _q.w());
+	const _UnderlyingType _s = _v == _UnderlyingType(0) ? _UnderlyingType(0) : _theta / _v;
+	return quaternion<_UnderlyingType>(std::log(abs(_q)), _s * _q.x(), _s * _q.y(), _s * _q.z());
+}
+} // namespace hypercomplex
 #endif // QUATERNION_HPP
 
 // footer-begin ------------------------------------------
 // default.C++
 // File       : quaternion.hpp
-// footer-end --------------------------------------------
\ No newline at end of file
+// footer-end --------------------------------------------
@@ -0,0 +1,323 @@
+// header-begin ------------------------------------------
+// File       : random.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Batch generation of complex Gaussian and uniform phase
+//      samples. The random bits come from Philox4x32-10
+//      (Salmon et al., "Parallel random numbers: as easy as
+//      1, 2, 3", SC 2011), a counter-based generator: sample
+//      i of a stream is a pure function of (seed, stream, i).
+//      The kernels therefore have no loop-carried state and
+//      vectorize, and a parallel fill returns the same
+//      values on any number of threads. Gaussian samples use
+//      the Box-Muller transform.
+//
+// header-end --------------------------------------------
+
+#ifndef RANDOM_HPP
+#define RANDOM_HPP
+
+#include "batch.hpp"
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+namespace hypercomplex
+{
+namespace __detail
+{
+// One Philox4x32-10 block
+inline std::array<std::uint32_t, 4>
+__philox(std::array<std::uint32_t, 4> _c, std::array<std::uint32_t, 2> _k)
+{
+	constexpr std::uint64_t _m0 = 0xD2511F53u, _m1 = 0xCD9E8D57u;
+	constexpr std::uint32_t _w0 = 0x9E3779B9u, _w1 = 0xBB67AE85u;
+	for (int _round = 0; _round < 10; ++_round)
+	{
+		const std::uint64_t _p0 = _m0 * _c[0];
+		const std::uint64_t _p1 = _m1 * _c[2];
+		_c = {static_cast<std::uint32_t>(_p1 >> 32) ^ _c[1] ^ _k[0], static_cast<std::uint32_t>(_p1),
+			  static_cast<std::uint32_t>(_p0 >> 32) ^ _c[3] ^ _k[1], static_cast<std::uint32_t>(_p0)};
+		_k[0] += _w0;
+		_k[1] += _w1;
+	}
+	return _c;
+}
+
+// SplitMix64 finalizer, used to derive child stream ids
+constexpr std::uint64_t
+__mix64(std::uint64_t _x)
+{
+	_x += 0x9E3779B97F4A7C15ull;
+	_x = (_x ^ (_x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	_x = (_x ^ (_x >> 27)) * 0x94D049BB133111EBull;
+	return _x ^ (_x >> 31);
+}
+} // namespace __detail
+
+// A stream of Philox blocks. Block i is philox(counter = (i, stream),
+// key = seed), so streams with different ids never overlap, and any
+// position can be reached in O(1) with discard().
+class philox_stream
+{
+  private:
+	std::uint64_t _seed, _stream, _position = 0;
+
+  public:
+	explicit constexpr philox_stream(std::uint64_t _s, std::uint64_t _id = 0) noexcept : _seed(_s), _stream(_id)
+	{
+	}
+
+	constexpr std::uint64_t
+	seed() const noexcept
+	{
+		return _seed;
+	}
+	constexpr std::uint64_t
+	stream() const noexcept
+	{
+		return _stream;
+	}
+	// Index of the next block a fill will use
+	constexpr std::uint64_t
+	position() const noexcept
+	{
+		return _position;
+	}
+	constexpr void
+	discard(std::uint64_t _n) noexcept
+	{
+		_position += _n;
+	}
+	// A child stream with the same seed, e.g. one per worker or per
+	// simulation run. Different _index values give different streams.
+	constexpr philox_stream
+	split(std::uint64_t _index) const noexcept
+	{
+		return philox_stream(_seed, __detail::__mix64(_stream ^ __detail::__mix64(_index)));
+	}
+	// Block _i of the stream, independent of position()
+	std::array<std::uint32_t, 4>
+	block(std::uint64_t _i) const noexcept
+	{
+		return __detail::__philox({static_cast<std::uint32_t>(_i), static_cast<std::uint32_t>(_i >> 32),
+								   static_cast<std::uint32_t>(_stream), static_cast<std::uint32_t>(_stream >> 32)},
+								  {static_cast<std::uint32_t>(_seed), static_cast<std::uint32_t>(_seed >> 32)});
+	}
+};
+
+// Sample Generators
+//      gaussian_noise : circularly symmetric Gaussian, E|z|^2 = sigma^2
+//                       (real and imaginary parts each of variance
+//                       sigma^2 / 2, independent)
+//      uniform_phase  : magnitude * exp(i theta), theta uniform in
+//                       [0, 2 pi)
+// Sample i of a call uses block position() + i, and the call advances
+// position() by the number of samples. Both also have an overload
+// taking an execution policy first.
+template <typename _UnderlyingType>
+void gaussian_noise(philox_stream &, std::span<complex<_UnderlyingType>>, std::type_identity_t<_UnderlyingType> = 1,
+					accuracy = accuracy::precise);
+template <typename _UnderlyingType>
+void uniform_phase(philox_stream &, std::span<complex<_UnderlyingType>>, std::type_identity_t<_UnderlyingType> = 1,
+				   accuracy = accuracy::precise);
+
+namespace __detail
+{
+// Uniform in (0, 1] from the top bits of _hi:_lo, never zero so its
+// log is finite
+template <typename _UnderlyingType>
+inline _UnderlyingType
+__unit_open(std::uint32_t _hi, std::uint32_t _lo)
+{
+	if constexpr (std::numeric_limits<_UnderlyingType>::digits <= 24)
+	{
+		return static_cast<_UnderlyingType>((_hi >> 8) + 1) * _UnderlyingType(0x1p-24);
+	}
+	else
+	{
+		const std::uint64_t _bits = (static_cast<std::uint64_t>(_hi) << 32 | _lo) >> 11;
+		return static_cast<_UnderlyingType>(_bits + 1) * _UnderlyingType(0x1p-53);
+	}
+}
+// Uniform in [0, 1)
+template <typename _UnderlyingType>
+inline _UnderlyingType
+__unit(std::uint32_t _hi, std::uint32_t _lo)
+{
+	if constexpr (std::numeric_limits<_UnderlyingType>::digits <= 24)
+	{
+		return static_cast<_UnderlyingType>(_hi >> 8) * _UnderlyingType(0x1p-24);
+	}
+	else
+	{
+		const std::uint64_t _bits = (static_cast<std::uint64_t>(_hi) << 32 | _lo) >> 11;
+		return static_cast<_UnderlyingType>(_bits) * _UnderlyingType(0x1p-53);
+	}
+}
+
+// log of a positive normal number. The approximations split x = m 2^e
+// with m in [sqrt(1/2), sqrt(2)) and sum the atanh series of
+// s = (m - 1) / (m + 1): fast to s^5 (error ~1e-6), balanced to s^9
+// (~1e-9).
+template <accuracy _Accuracy, typename _UnderlyingType>
+inline _UnderlyingType
+__log_positive(_UnderlyingType _x)
+{
+	constexpr bool _is_float = std::is_same_v<_UnderlyingType, float>;
+	if constexpr (_Accuracy == accuracy::precise || !(_is_float || std::is_same_v<_UnderlyingType, double>))
+	{
+		return std::log(_x);
+	}
+	else
+	{
+		using _Bits = std::conditional_t<_is_float, std::uint32_t, std::uint64_t>;
+		constexpr int _mantissa = std::numeric_limits<_UnderlyingType>::digits - 1;
+		constexpr _Bits _bias = std::numeric_limits<_UnderlyingType>::max_exponent - 1;
+		constexpr _Bits _mask = (_Bits(1) << _mantissa) - 1;
+		const _Bits _b = std::bit_cast<_Bits>(_x);
+		_UnderlyingType _e = static_cast<_UnderlyingType>(static_cast<int>(_b >> _mantissa) - static_cast<int>(_bias));
+		_UnderlyingType _m = std::bit_cast<_UnderlyingType>((_b & _mask) | (_bias << _mantissa));
+		const bool _high = _m > _UnderlyingType(1.4142135623730950488L);
+		_m = _high ? _m * _UnderlyingType(0.5) : _m;
+		_e = _high ? _e + _UnderlyingType(1) : _e;
+
+		const _UnderlyingType _s = (_m - _UnderlyingType(1)) / (_m + _UnderlyingType(1));
+		const _UnderlyingType _z = _s * _s;
+		_UnderlyingType _p;
+		if constexpr (_Accuracy == accuracy::fast)
+		{
+			_p = _UnderlyingType(1.0L / 5);
+		}
+		else
+		{
+			_p = _UnderlyingType(1.0L / 9);
+			_p = _p * _z + _UnderlyingType(1.0L / 7);
+			_p = _p * _z + _UnderlyingType(1.0L / 5);
+		}
+		_p = _p * _z + _UnderlyingType(1.0L / 3);
+		_p = _p * _z + _UnderlyingType(1);
+		return _e * _UnderlyingType(0.69314718055994530942L) + _UnderlyingType(2) * _s * _p;
+	}
+}
+
+// Fills _out[0, _n) from blocks _first, _first + 1, ... of _stream.
+// Each block of samples first expands the Philox output to uniforms,
+// then maps them to radius and phase.
+template <bool _Gaussian, accuracy _Accuracy, typename _UnderlyingType>
+inline void
+__noise(const philox_stream &_stream, std::uint64_t _first, complex<_UnderlyingType> *_out, std::size_t _n,
+		_UnderlyingType _scale)
+{
+	constexpr std::size_t _block = 64;
+	constexpr _UnderlyingType _two_pi = static_cast<_UnderlyingType>(2 * __pi);
+	_UnderlyingType _u[_block], _v[_block];
+	for (std::size_t _b = 0; _b < _n; _b += _block)
+	{
+		const std::size_t _len = std::min(_block, _n - _b);
+		for (std::size_t _i = 0; _i < _len; ++_i)
+		{
+			const std::array<std::uint32_t, 4> _r = _stream.block(_first + _b + _i);
+			_u[_i] = __unit_open<_UnderlyingType>(_r[0], _r[1]);
+			_v[_i] = __unit<_UnderlyingType>(_r[2], _r[3]);
+		}
+		for (std::size_t _i = 0; _i < _len; ++_i)
+		{
+			const _UnderlyingType _radius
+				= _Gaussian ? _scale * std::sqrt(-__log_positive<_Accuracy>(_u[_i])) : _scale;
+			const _UnderlyingType _t = _two_pi * _v[_i];
+			_UnderlyingType _s, _c;
+			if constexpr (_Accuracy == accuracy::precise)
+			{
+				_s = std::sin(_t);
+				_c = std::cos(_t);
+			}
+			else
+			{
+				__sincos<_Accuracy>(_t, _s, _c);
+			}
+			_out[_b + _i] = complex<_UnderlyingType>(_radius * _c, _radius * _s);
+		}
+	}
+}
+
+template <bool _Gaussian, typename _Policy, typename _UnderlyingType>
+inline void
+__noise(const _Policy &_policy, philox_stream &_stream, std::span<complex<_UnderlyingType>> _out,
+		_UnderlyingType _scale, accuracy _acc)
+{
+	const std::uint64_t _first = _stream.position();
+	__for_each_chunk(
+		_policy, _out.size(),
+		[&](std::size_t _begin, std::size_t _end)
+		{
+			complex<_UnderlyingType> *_p = _out.data() + _begin;
+			const std::size_t _n = _end - _begin;
+			switch (_acc)
+			{
+			case accuracy::fast:
+				__noise<_Gaussian, accuracy::fast>(_stream, _first + _begin, _p, _n, _scale);
+				break;
+			case accuracy::balanced:
+				__noise<_Gaussian, accuracy::balanced>(_stream, _first + _begin, _p, _n, _scale);
+				break;
+			case accuracy::precise:
+				__noise<_Gaussian, accuracy::precise>(_stream, _first + _begin, _p, _n, _scale);
+				break;
+			}
+		},
+		__transcendental_grain);
+	_stream.discard(_out.size());
+}
+} // namespace __detail
+
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+gaussian_noise(const _Policy &_policy, philox_stream &_stream, std::span<complex<_UnderlyingType>> _out,
+			   std::type_identity_t<_UnderlyingType> _sigma = 1, accuracy _acc = accuracy::precise)
+{
+	__detail::__noise<true>(_policy, _stream, _out, _sigma, _acc);
+}
+template <execution::execution_policy _Policy, typename _UnderlyingType>
+void
+uniform_phase(const _Policy &_policy, philox_stream &_stream, std::span<complex<_UnderlyingType>> _out,
+			  std::type_identity_t<_UnderlyingType> _magnitude = 1, accuracy _acc = accuracy::precise)
+{
+	__detail::__noise<false>(_policy, _stream, _out, _magnitude, _acc);
+}
+
+template <typename _UnderlyingType>
+void
+gaussian_noise(philox_stream &_stream, std::span<complex<_UnderlyingType>> _out,
+			   std::type_identity_t<_UnderlyingType> _sigma, accuracy _acc)
+{
+	__detail::__noise<true>(execution::seq, _stream, _out, _sigma, _acc);
+}
+template <typename _UnderlyingType>
+void
+uniform_phase(philox_stream &_stream, std::span<complex<_UnderlyingType>> _out,
+			  std::type_identity_t<_UnderlyingType> _magnitude, accuracy _acc)
+{
+	__detail::__noise<false>(execution::seq, _stream, _out, _magnitude, _acc);
+}
+} // namespace hypercomplex
+#endif // RANDOM_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : random.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,298 @@
+// header-begin ------------------------------------------
+// File       : reduce.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Compensated reductions over spans of complex numbers.
+//      The input is cut into chunks of a fixed size that does
+//      not depend on the thread count. Each chunk is summed
+//      with Kahan-Neumaier compensation in independent lanes,
+//      and the chunk results are combined in a fixed pairwise
+//      tree, so sequential and parallel calls return the same
+//      bits on any number of threads.
+//
+// header-end --------------------------------------------
+
+#ifndef REDUCE_HPP
+#define REDUCE_HPP
+
+#include "complex.hpp"
+#include "execution.hpp"
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace hypercomplex
+{
+// Reductions
+//      sum      : sum of a_i
+//      mean     : sum / n (NaN for an empty span)
+//      dot      : sum of conj(a_i) * b_i
+//      norm2    : sqrt(sum of |a_i|^2)
+//      variance : sum of |a_i - mean|^2 / n
+// Each also has an overload taking an execution policy after the
+// template arguments, e.g. sum<float>(execution::par, a).
+template <typename _UnderlyingType>
+complex<_UnderlyingType> sum(std::span<const complex<std::type_identity_t<_UnderlyingType>>>);
+template <typename _UnderlyingType>
+complex<_UnderlyingType> mean(std::span<const complex<std::type_identity_t<_UnderlyingType>>>);
+template <typename _UnderlyingType>
+complex<_UnderlyingType> dot(std::span<const complex<std::type_identity_t<_UnderlyingType>>>,
+							 std::span<const complex<std::type_identity_t<_UnderlyingType>>>);
+template <typename _UnderlyingType>
+_UnderlyingType norm2(std::span<const complex<std::type_identity_t<_UnderlyingType>>>);
+template <typename _UnderlyingType>
+_UnderlyingType variance(std::span<const complex<std::type_identity_t<_UnderlyingType>>>);
+
+namespace __detail
+{
+// Elements per chunk; part of the result's definition, so it must not
+// depend on the machine
+constexpr std::size_t __reduction_chunk = 8192;
+// Independent accumulators per component, enough to fill a vector
+// register and hide the add latency
+constexpr std::size_t __reduction_lanes = 8;
+
+// Combines _lanes[0.._Lanes) into _lanes[0] pairwise, with
+// _merge(_lanes[l], _lanes[l + w]) folding the upper half onto the lower
+template <typename _Tp, std::size_t _Lanes, typename _Merge>
+constexpr void
+__fold_lanes(_Tp (&_lanes)[_Lanes], _Merge _merge)
+{
+	for (std::size_t _w = _Lanes / 2; _w > 0; _w /= 2)
+	{
+		for (std::size_t _l = 0; _l < _w; ++_l)
+		{
+			_merge(_lanes[_l], _lanes[_l + _w]);
+		}
+	}
+}
+
+// Running sum with its Neumaier compensation term
+template <typename _UnderlyingType> struct __compensated
+{
+	_UnderlyingType _sum = 0, _comp = 0;
+
+	constexpr void
+	add(_UnderlyingType _x)
+	{
+		const _UnderlyingType _t = _sum + _x;
+		const bool _big = std::abs(_sum) >= std::abs(_x);
+		_comp += _big ? (_sum - _t) + _x : (_x - _t) + _sum;
+		_sum = _t;
+	}
+	constexpr void
+	merge(const __compensated &_o)
+	{
+		add(_o._sum);
+		_comp += _o._comp;
+	}
+	constexpr _UnderlyingType
+	value() const
+	{
+		return _sum + _comp;
+	}
+};
+
+// Sums the _Width values _term(i, v) produces for every i in
+// [_begin, _end). Element i goes to lane i % lanes; the lanes are folded
+// pairwise at the end.
+template <std::size_t _Width, typename _UnderlyingType, typename _Term>
+inline std::array<__compensated<_UnderlyingType>, _Width>
+__reduce_chunk(std::size_t _begin, std::size_t _end, _Term &_term)
+{
+	constexpr std::size_t _lanes = __reduction_lanes;
+	_UnderlyingType _s[_Width][_lanes] = {}, _c[_Width][_lanes] = {};
+	auto _step = [&](std::size_t _l, std::size_t _i)
+	{
+		_UnderlyingType _v[_Width];
+		_term(_i, _v);
+		for (std::size_t _k = 0; _k < _Width; ++_k)
+		{
+			const _UnderlyingType _t = _s[_k][_l] + _v[_k];
+			const bool _big = std::abs(_s[_k][_l]) >= std::abs(_v[_k]);
+			_c[_k][_l] += _big ? (_s[_k][_l] - _t) + _v[_k] : (_v[_k] - _t) + _s[_k][_l];
+			_s[_k][_l] = _t;
+		}
+	};
+	std::size_t _i = _begin;
+	for (; _i + _lanes <= _end; _i += _lanes)
+	{
+		for (std::size_t _l = 0; _l < _lanes; ++_l)
+		{
+			_step(_l, _i + _l);
+		}
+	}
+	for (std::size_t _l = 0; _i + _l < _end; ++_l)
+	{
+		_step(_l, _i + _l);
+	}
+
+	std::array<__compensated<_UnderlyingType>, _Width> _r;
+	for (std::size_t _k = 0; _k < _Width; ++_k)
+	{
+		__compensated<_UnderlyingType> _acc[_lanes];
+		for (std::size_t _l = 0; _l < _lanes; ++_l)
+		{
+			_acc[_l] = {_s[_k][_l], _c[_k][_l]};
+		}
+		__fold_lanes(_acc, [](__compensated<_UnderlyingType> &_a, const __compensated<_UnderlyingType> &_b)
+					 { _a.merge(_b); });
+		_r[_k] = _acc[0];
+	}
+	return _r;
+}
+
+// Reduces [0, _n) chunk by chunk, in parallel if _policy asks, and
+// combines the chunk results pairwise in chunk order.
+template <std::size_t _Width, typename _UnderlyingType, typename _Policy, typename _Term>
+inline std::array<_UnderlyingType, _Width>
+__reduce(const _Policy &_policy, std::size_t _n, _Term _term)
+{
+	using _Partial = std::array<__compensated<_UnderlyingType>, _Width>;
+	const std::size_t _chunks = (_n + __reduction_chunk - 1) / __reduction_chunk;
+	std::vector<_Partial> _partials(_chunks);
+	__for_each_chunk(
+		_policy, _chunks,
+		[&](std::size_t _begin, std::size_t _end)
+		{
+			for (std::size_t _c = _begin; _c < _end; ++_c)
+			{
+				const std::size_t _e = (_c + 1) * __reduction_chunk;
+				_partials[_c] = __reduce_chunk<_Width, _UnderlyingType>(_c * __reduction_chunk, _e < _n ? _e : _n, _term);
+			}
+		},
+		1);
+
+	for (std::size_t _stride = 1; _stride < _chunks; _stride *= 2)
+	{
+		for (std::size_t _c = 0; _c + _stride < _chunks; _c += 2 * _stride)
+		{
+			for (std::size_t _k = 0; _k < _Width; ++_k)
+			{
+				_partials[_c][_k].merge(_partials[_c + _stride][_k]);
+			}
+		}
+	}
+	std::array<_UnderlyingType, _Width> _r{};
+	for (std::size_t _k = 0; _k < _Width && _chunks > 0; ++_k)
+	{
+		_r[_k] = _partials[0][_k].value();
+	}
+	return _r;
+}
+} // namespace __detail
+
+template <typename _UnderlyingType, execution::execution_policy _Policy>
+complex<_UnderlyingType>
+sum(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	const auto _r = __detail::__reduce<2, _UnderlyingType>(_policy, _a.size(),
+														  [&](std::size_t _i, _UnderlyingType(&_v)[2])
+														  {
+															  _v[0] = _a[_i].real();
+															  _v[1] = _a[_i].imag();
+														  });
+	return complex<_UnderlyingType>(_r[0], _r[1]);
+}
+template <typename _UnderlyingType, execution::execution_policy _Policy>
+complex<_UnderlyingType>
+mean(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	const complex<_UnderlyingType> _s = sum<_UnderlyingType>(_policy, _a);
+	const _UnderlyingType _n = static_cast<_UnderlyingType>(_a.size());
+	return complex<_UnderlyingType>(_s.real() / _n, _s.imag() / _n);
+}
+template <typename _UnderlyingType, execution::execution_policy _Policy>
+complex<_UnderlyingType>
+dot(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+	std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b)
+{
+	assert(_a.size() == _b.size());
+	const auto _r = __detail::__reduce<2, _UnderlyingType>(
+		_policy, _a.size(),
+		[&](std::size_t _i, _UnderlyingType(&_v)[2])
+		{
+			const _UnderlyingType _ar = _a[_i].real(), _ai = _a[_i].imag();
+			const _UnderlyingType _br = _b[_i].real(), _bi = _b[_i].imag();
+			_v[0] = _ar * _br + _ai * _bi;
+			_v[1] = _ar * _bi - _ai * _br;
+		});
+	return complex<_UnderlyingType>(_r[0], _r[1]);
+}
+template <typename _UnderlyingType, execution::execution_policy _Policy>
+_UnderlyingType
+norm2(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	const auto _r = __detail::__reduce<1, _UnderlyingType>(_policy, _a.size(),
+														  [&](std::size_t _i, _UnderlyingType(&_v)[1])
+														  {
+															  const _UnderlyingType _x = _a[_i].real(), _y = _a[_i].imag();
+															  _v[0] = _x * _x + _y * _y;
+														  });
+	return std::sqrt(_r[0]);
+}
+// Two passes: the mean, then the compensated sum of squared deviations
+template <typename _UnderlyingType, execution::execution_policy _Policy>
+_UnderlyingType
+variance(const _Policy &_policy, std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	const complex<_UnderlyingType> _m = mean<_UnderlyingType>(_policy, _a);
+	const auto _r = __detail::__reduce<1, _UnderlyingType>(_policy, _a.size(),
+														  [&](std::size_t _i, _UnderlyingType(&_v)[1])
+														  {
+															  const _UnderlyingType _x = _a[_i].real() - _m.real();
+															  const _UnderlyingType _y = _a[_i].imag() - _m.imag();
+															  _v[0] = _x * _x + _y * _y;
+														  });
+	return _r[0] / static_cast<_UnderlyingType>(_a.size());
+}
+
+template <typename _UnderlyingType>
+complex<_UnderlyingType>
+sum(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	return sum<_UnderlyingType>(execution::seq, _a);
+}
+template <typename _UnderlyingType>
+complex<_UnderlyingType>
+mean(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	return mean<_UnderlyingType>(execution::seq, _a);
+}
+template <typename _UnderlyingType>
+complex<_UnderlyingType>
+dot(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a,
+	std::span<const complex<std::type_identity_t<_UnderlyingType>>> _b)
+{
+	return dot<_UnderlyingType>(execution::seq, _a, _b);
+}
+template <typename _UnderlyingType>
+_UnderlyingType
+norm2(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	return norm2<_UnderlyingType>(execution::seq, _a);
+}
+template <typename _UnderlyingType>
+_UnderlyingType
+variance(std::span<const complex<std::type_identity_t<_UnderlyingType>>> _a)
+{
+	return variance<_UnderlyingType>(execution::seq, _a);
+}
+} // namespace hypercomplex
+#endif // REDUCE_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : reduce.hpp
+// footer-end --------------------------------------------
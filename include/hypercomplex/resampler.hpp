@@ -0,0 +1,438 @@
+// header-begin ------------------------------------------
+// File       : resampler.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Streaming sample rate conversion of complex signals
+//      with real filters. polyphase_resampler changes the
+//      rate by any ratio L/M: of the prototype filter
+//      running at L times the input rate it only evaluates
+//      the phase each kept output needs, so neither the
+//      zeros of upsampling nor the outputs dropped by
+//      downsampling are computed. halfband_decimator halves
+//      the rate with a half-band filter, whose every other
+//      tap is zero and whose other taps are symmetric, for
+//      about a quarter of the multiplies of a plain filter.
+//      Like fir_filter both keep their history between
+//      process() calls, so the output does not depend on how
+//      the stream was split into blocks.
+//
+// header-end --------------------------------------------
+
+#ifndef RESAMPLER_HPP
+#define RESAMPLER_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+#include "interleave.hpp"
+#include "reduce.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <numbers>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace hypercomplex
+{
+namespace __detail
+{
+// Zeroth order modified Bessel function of the first kind, by its
+// power series
+template <typename _UnderlyingType>
+inline _UnderlyingType
+__bessel_i0(_UnderlyingType _x)
+{
+	const _UnderlyingType _q = _x * _x / _UnderlyingType(4);
+	_UnderlyingType _term = 1, _sum = 1;
+	for (int _k = 1; _k < 64 && _term > _sum * std::numeric_limits<_UnderlyingType>::epsilon(); ++_k)
+	{
+		_term *= _q / static_cast<_UnderlyingType>(_k * _k);
+		_sum += _term;
+	}
+	return _sum;
+}
+
+// Kaiser windowed sinc low-pass of _n taps with cutoff _fc (cycles per
+// sample) and DC gain _gain; beta 8 gives about 80 dB of stopband
+template <typename _UnderlyingType>
+inline array<_UnderlyingType>
+__kaiser_lowpass(std::size_t _n, double _fc, double _gain, double _beta = 8.0)
+{
+	array<_UnderlyingType> _h(_n);
+	const double _center = 0.5 * static_cast<double>(_n - 1);
+	const double _norm = __bessel_i0(_beta);
+	double _sum = 0;
+	std::vector<double> _w(_n);
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		const double _t = static_cast<double>(_i) - _center;
+		const double _r = _center > 0 ? _t / _center : 0.0;
+		const double _a = 2.0 * std::numbers::pi * _fc * _t;
+		const double _sinc = _t == 0 ? 1.0 : std::sin(_a) / _a;
+		_w[_i] = 2.0 * _fc * _sinc * __bessel_i0(_beta * std::sqrt(std::max(0.0, 1.0 - _r * _r))) / _norm;
+		_sum += _w[_i];
+	}
+	for (std::size_t _i = 0; _i < _n; ++_i)
+	{
+		_h[_i] = static_cast<_UnderlyingType>(_w[_i] * _gain / _sum);
+	}
+	return _h;
+}
+} // namespace __detail
+
+// Output m is y[m] = sum_k h[k] * u[m M - k], where u is the input
+// upsampled by L (L - 1 zeros after every sample) and h the prototype
+// filter running at L times the input rate. Phase p of h, the taps
+// h[p + L j], is stored reversed and zero padded to a multiple of the
+// accumulator lanes, so each output is one dense dot product against
+// the input history.
+template <typename _UnderlyingType> class polyphase_resampler
+{
+  private:
+	// Input samples deinterleaved per pass
+	static constexpr std::size_t __chunk = 256;
+	static constexpr std::size_t __lanes = __detail::__reduction_lanes;
+
+	std::size_t _up, _down;
+	// Taps per phase after padding
+	std::size_t _length = 0;
+	// _up phases of _length taps each
+	array<_UnderlyingType> _phases;
+	// The last _length - 1 inputs followed by the chunk being consumed
+	array<_UnderlyingType> _x_re, _x_im;
+	// Phase of the next output and the input it ends on, counted from
+	// the start of the current chunk
+	std::size_t _phase = 0, _next = 0;
+
+	void
+	__setup(std::span<const _UnderlyingType> _taps)
+	{
+		if (_up == 0 || _down == 0)
+		{
+			throw std::invalid_argument("polyphase_resampler: the up and down factors must be positive");
+		}
+		if (_taps.empty())
+		{
+			throw std::invalid_argument("polyphase_resampler: no coefficients");
+		}
+		_length = (_taps.size() + _up - 1) / _up;
+		_length = (_length + __lanes - 1) / __lanes * __lanes;
+		_phases = array<_UnderlyingType>(_up * _length);
+		for (std::size_t _k = 0; _k < _taps.size(); ++_k)
+		{
+			_phases[(_k % _up) * _length + _length - 1 - _k / _up] = _taps[_k];
+		}
+		_x_re = array<_UnderlyingType>(_length - 1 + __chunk);
+		_x_im = array<_UnderlyingType>(_length - 1 + __chunk);
+	}
+
+	// sum_j g[j] x[j] for both components, with the lanes of reduce.hpp
+	static void
+	__dot(const _UnderlyingType *__restrict _g, const _UnderlyingType *__restrict _xr,
+		  const _UnderlyingType *__restrict _xi, std::size_t _n, _UnderlyingType &_re, _UnderlyingType &_im)
+	{
+		_UnderlyingType _sr[__lanes] = {}, _si[__lanes] = {};
+		for (std::size_t _j = 0; _j < _n; _j += __lanes)
+		{
+			for (std::size_t _l = 0; _l < __lanes; ++_l)
+			{
+				_sr[_l] += _g[_j + _l] * _xr[_j + _l];
+				_si[_l] += _g[_j + _l] * _xi[_j + _l];
+			}
+		}
+		const auto _plus = [](_UnderlyingType &_a, _UnderlyingType _b) { _a += _b; };
+		__detail::__fold_lanes(_sr, _plus);
+		__detail::__fold_lanes(_si, _plus);
+		_re = _sr[0];
+		_im = _si[0];
+	}
+
+  public:
+	// _taps is the prototype low-pass at _up times the input rate; its
+	// DC gain should be _up to keep the signal level. Throws
+	// std::invalid_argument for a zero factor or an empty filter.
+	polyphase_resampler(std::size_t _up_factor, std::size_t _down_factor, std::span<const _UnderlyingType> _taps)
+		: _up(_up_factor), _down(_down_factor)
+	{
+		__setup(_taps);
+	}
+	// Designs the prototype: a Kaiser windowed sinc cut off at the lower
+	// of the two Nyquist rates, _taps_per_phase * max(L, M) taps long.
+	// The ratio is reduced to lowest terms first.
+	polyphase_resampler(std::size_t _up_factor, std::size_t _down_factor, std::size_t _taps_per_phase = 24)
+		: _up(_up_factor), _down(_down_factor)
+	{
+		if (_up == 0 || _down == 0 || _taps_per_phase == 0)
+		{
+			throw std::invalid_argument("polyphase_resampler: the factors and filter length must be positive");
+		}
+		const std::size_t _g = std::gcd(_up, _down);
+		_up /= _g;
+		_down /= _g;
+		const std::size_t _rate = std::max(_up, _down);
+		const auto _h = __detail::__kaiser_lowpass<_UnderlyingType>(_taps_per_phase * _rate | 1, 0.5 / _rate,
+																	 static_cast<double>(_up));
+		__setup(std::span<const _UnderlyingType>(_h.data(), _h.size()));
+	}
+
+	inline std::size_t
+	up() const noexcept
+	{
+		return _up;
+	}
+	inline std::size_t
+	down() const noexcept
+	{
+		return _down;
+	}
+	// Taps of each phase, including the zero padding
+	inline std::size_t
+	taps_per_phase() const noexcept
+	{
+		return _length;
+	}
+	// Most outputs process() can write for _n inputs. After N inputs in
+	// total exactly ceil(N L / M) outputs have been written.
+	inline std::size_t
+	output_size(std::size_t _n) const noexcept
+	{
+		return (_n * _up + _down - 1) / _down + 1;
+	}
+
+	// Resamples the next _n samples of the stream and returns the number
+	// of outputs written. _in and _out may not overlap.
+	std::size_t
+	process(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n)
+	{
+		const std::size_t _history = _length - 1;
+		_UnderlyingType *_xr = _x_re.data();
+		_UnderlyingType *_xi = _x_im.data();
+		std::size_t _written = 0;
+		while (_n != 0)
+		{
+			const std::size_t _c = std::min(_n, __chunk);
+			__detail::__deinterleave(reinterpret_cast<const _UnderlyingType *>(_in), _xr + _history, _xi + _history, _c);
+			for (; _next < _c; ++_written)
+			{
+				_UnderlyingType _re, _im;
+				__dot(_phases.data() + _phase * _length, _xr + _next, _xi + _next, _length, _re, _im);
+				_out[_written] = complex<_UnderlyingType>(_re, _im);
+				_phase += _down;
+				_next += _phase / _up;
+				_phase %= _up;
+			}
+			_next -= _c;
+			std::copy_n(_xr + _c, _history, _xr);
+			std::copy_n(_xi + _c, _history, _xi);
+			_in += _c;
+			_n -= _c;
+		}
+		return _written;
+	}
+	std::size_t
+	process(std::span<const complex<_UnderlyingType>> _in, std::span<complex<_UnderlyingType>> _out)
+	{
+		assert(_out.size() >= output_size(_in.size()));
+		return process(_in.data(), _out.data(), _in.size());
+	}
+
+	// Forgets the stream history, as if no sample had been processed
+	void
+	reset()
+	{
+		std::fill(_x_re.begin(), _x_re.end(), _UnderlyingType(0));
+		std::fill(_x_im.begin(), _x_im.end(), _UnderlyingType(0));
+		_phase = 0;
+		_next = 0;
+	}
+};
+
+// Decimation by two with a half-band filter h of 4J - 1 taps: the taps
+// at even, nonzero offsets from the center c = 2J - 1 are zero, the
+// taps h[2j] at odd offsets are not, and h[c - k] = h[c + k]. With e[k] = x[2k] and o[k] = x[2k + 1] the output is
+// y[m] = h[c] o[m - J] + sum_{j<J} h[2j] (e[m - j] + e[m - 2J + 1 + j]),
+// J multiplies per component instead of 4J - 1, vectorized across
+// outputs as fir_filter's direct path is.
+template <typename _UnderlyingType> class halfband_decimator
+{
+  private:
+	// Even input samples (outputs) per pass
+	static constexpr std::size_t __chunk = 256;
+
+	std::size_t _half;
+	// h[0], h[2], ..., h[2J - 2] and h[c]
+	array<_UnderlyingType> _h;
+	_UnderlyingType _center;
+	// Even samples: 2J - 1 of history, then this pass's. Odd samples: J
+	// of history, then this pass's; the odd stream is _behind samples
+	// behind the even one at the start of a pass. A pass ends with the
+	// process() call or after __chunk even samples, and y[m] is written
+	// as soon as e[m] is in, since it needs only older odd samples.
+	array<_UnderlyingType> _e_re, _e_im, _o_re, _o_im, _acc_re, _acc_im;
+	std::size_t _evens = 0, _odds = 0, _behind = 0;
+	bool _odd_next = false;
+
+	void
+	__setup(std::span<const _UnderlyingType> _taps)
+	{
+		if (_taps.size() % 4 != 3)
+		{
+			throw std::invalid_argument("halfband_decimator: a half-band filter has 4J - 1 taps");
+		}
+		_half = (_taps.size() + 1) / 4;
+		_h = array<_UnderlyingType>(_half);
+		for (std::size_t _j = 0; _j < _half; ++_j)
+		{
+			_h[_j] = _taps[2 * _j];
+		}
+		_center = _taps[2 * _half - 1];
+		_e_re = array<_UnderlyingType>(2 * _half - 1 + __chunk);
+		_e_im = array<_UnderlyingType>(2 * _half - 1 + __chunk);
+		_o_re = array<_UnderlyingType>(_half + __chunk + 1);
+		_o_im = array<_UnderlyingType>(_half + __chunk + 1);
+		_acc_re = array<_UnderlyingType>(__chunk);
+		_acc_im = array<_UnderlyingType>(__chunk);
+	}
+
+	// Writes the outputs of this pass's even samples and moves the
+	// histories down
+	void
+	__flush(complex<_UnderlyingType> *_out)
+	{
+		const std::size_t _he = 2 * _half - 1, _ho = _half, _c = _evens;
+		const _UnderlyingType *__restrict _er = _e_re.data();
+		const _UnderlyingType *__restrict _ei = _e_im.data();
+		const _UnderlyingType *__restrict _or = _o_re.data() + _behind;
+		const _UnderlyingType *__restrict _oi = _o_im.data() + _behind;
+		_UnderlyingType *__restrict _ar = _acc_re.data();
+		_UnderlyingType *__restrict _ai = _acc_im.data();
+		for (std::size_t _m = 0; _m < _c; ++_m)
+		{
+			_ar[_m] = _center * _or[_m];
+			_ai[_m] = _center * _oi[_m];
+		}
+		for (std::size_t _j = 0; _j < _half; ++_j)
+		{
+			const _UnderlyingType _g = _h[_j];
+			const _UnderlyingType *_ar0 = _er + _he - _j, *_ar1 = _er + _j;
+			const _UnderlyingType *_ai0 = _ei + _he - _j, *_ai1 = _ei + _j;
+			for (std::size_t _m = 0; _m < _c; ++_m)
+			{
+				_ar[_m] += _g * (_ar0[_m] + _ar1[_m]);
+				_ai[_m] += _g * (_ai0[_m] + _ai1[_m]);
+			}
+		}
+		__detail::__interleave(_ar, _ai, reinterpret_cast<_UnderlyingType *>(_out), _c);
+
+		std::copy_n(_e_re.data() + _c, _he, _e_re.data());
+		std::copy_n(_e_im.data() + _c, _he, _e_im.data());
+		std::copy_n(_o_re.data() + _odds, _ho, _o_re.data());
+		std::copy_n(_o_im.data() + _odds, _ho, _o_im.data());
+		_behind += _evens - _odds;
+		_evens = 0;
+		_odds = 0;
+	}
+
+  public:
+	// _taps is the whole filter, of 4J - 1 taps. Only the even taps of
+	// the first half and the center are read: the rest are taken to be
+	// zero or mirror images, whatever rounding left in them. Throws
+	// std::invalid_argument for any other length.
+	explicit halfband_decimator(std::span<const _UnderlyingType> _taps) { __setup(_taps); }
+	// Designs a Kaiser windowed half-band filter of _taps taps, rounded up
+	// to the next 4J - 1
+	explicit halfband_decimator(std::size_t _taps = 31)
+	{
+		const std::size_t _n = (std::max<std::size_t>(_taps, 3) + 1 + 3) / 4 * 4 - 1;
+		const auto _design = __detail::__kaiser_lowpass<_UnderlyingType>(_n, 0.25, 1.0);
+		__setup(std::span<const _UnderlyingType>(_design.data(), _design.size()));
+	}
+
+	// Filter length, 4J - 1
+	inline std::size_t
+	taps() const noexcept
+	{
+		return 4 * _half - 1;
+	}
+	// Most outputs process() can write for _n inputs. After N inputs in
+	// total exactly ceil(N / 2) outputs have been written.
+	inline std::size_t
+	output_size(std::size_t _n) const noexcept
+	{
+		return _n / 2 + 1;
+	}
+
+	// Decimates the next _n samples of the stream and returns the number
+	// of outputs written. _in and _out may not overlap.
+	std::size_t
+	process(const complex<_UnderlyingType> *_in, complex<_UnderlyingType> *_out, std::size_t _n)
+	{
+		const std::size_t _he = 2 * _half - 1, _ho = _half;
+		std::size_t _written = 0;
+		for (std::size_t _i = 0; _i < _n; ++_i)
+		{
+			if (_odd_next)
+			{
+				_o_re[_ho + _odds] = _in[_i].real();
+				_o_im[_ho + _odds] = _in[_i].imag();
+				++_odds;
+			}
+			else
+			{
+				if (_evens == __chunk)
+				{
+					__flush(_out + _written);
+					_written += __chunk;
+				}
+				_e_re[_he + _evens] = _in[_i].real();
+				_e_im[_he + _evens] = _in[_i].imag();
+				++_evens;
+			}
+			_odd_next = !_odd_next;
+		}
+		const std::size_t _c = _evens;
+		if (_c != 0)
+		{
+			__flush(_out + _written);
+			_written += _c;
+		}
+		return _written;
+	}
+	std::size_t
+	process(std::span<const complex<_UnderlyingType>> _in, std::span<complex<_UnderlyingType>> _out)
+	{
+		assert(_out.size() >= output_size(_in.size()));
+		return process(_in.data(), _out.data(), _in.size());
+	}
+
+	// Forgets the stream history, as if no sample had been processed
+	void
+	reset()
+	{
+		std::fill(_e_re.begin(), _e_re.end(), _UnderlyingType(0));
+		std::fill(_e_im.begin(), _e_im.end(), _UnderlyingType(0));
+		std::fill(_o_re.begin(), _o_re.end(), _UnderlyingType(0));
+		std::fill(_o_im.begin(), _o_im.end(), _UnderlyingType(0));
+		_evens = 0;
+		_odds = 0;
+		_behind = 0;
+		_odd_next = false;
+	}
+};
+} // namespace hypercomplex
+#endif // RESAMPLER_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : resampler.hpp
+// footer-end --------------------------------------------
@@ -0,0 +1,429 @@
+// header-begin ------------------------------------------
+// File       : ring.hpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Bounded lock-free ring buffers of complex sample
+//      blocks for handing data between threads. Blocks
+//      live in one preallocated slab; a producer reserves
+//      a block, fills it in place and commits it, and a
+//      consumer acquires it, reads it in place and releases
+//      it, so samples are never copied. The indices written
+//      by each side sit on their own cache lines.
+//
+//      Blocking calls either spin (wait_policy::busy_poll,
+//      lowest latency, burns a core) or sleep in the kernel
+//      through std::atomic wait/notify, a futex on Linux
+//      (wait_policy::futex).
+//
+// header-end --------------------------------------------
+
+#ifndef RING_HPP
+#define RING_HPP
+
+#include "array.hpp"
+#include "complex.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace hypercomplex
+{
+enum class wait_policy
+{
+	busy_poll,
+	futex
+};
+
+namespace __detail
+{
+constexpr std::size_t __cache_line_size = 64;
+
+inline void
+__cpu_relax() noexcept
+{
+#if defined(__x86_64__) || defined(__i386__)
+	_mm_pause();
+#elif defined(__aarch64__)
+	asm volatile("yield");
+#else
+	std::this_thread::yield();
+#endif
+}
+
+// Wake-up channel for threads blocked on a ring. With busy_poll nothing
+// is signalled and waiters spin on their condition.
+template <wait_policy _Wait> struct alignas(__cache_line_size) __event
+{
+	std::atomic<std::uint32_t> _count{0};
+
+	inline void
+	__notify() noexcept
+	{
+		if constexpr (_Wait == wait_policy::futex)
+		{
+			_count.fetch_add(1, std::memory_order_release);
+			_count.notify_all();
+		}
+	}
+	// Returns once _ready() holds. The count is read before the
+	// condition, so a notify after a failed check changes it and the
+	// wait returns.
+	template <typename _Predicate>
+	inline void
+	__wait(_Predicate _ready) const
+	{
+		for (std::size_t _spins = 1;; ++_spins)
+		{
+			const std::uint32_t _seen = _count.load(std::memory_order_acquire);
+			if (_ready())
+			{
+				return;
+			}
+			if constexpr (_Wait == wait_policy::busy_poll)
+			{
+				// Give the core away now and then in case the other side is
+				// waiting for it
+				if (_spins % 1024 == 0)
+				{
+					std::this_thread::yield();
+				}
+				else
+				{
+					__cpu_relax();
+				}
+			}
+			else
+			{
+				_count.wait(_seen, std::memory_order_acquire);
+			}
+		}
+	}
+};
+
+// Samples per block rounded up so every block starts on a cache line
+template <typename _Tp>
+constexpr std::size_t
+__block_stride(std::size_t _block_size)
+{
+	constexpr std::size_t _per_line = __cache_line_size / sizeof(_Tp);
+	return _per_line == 0 ? _block_size : (_block_size + _per_line - 1) / _per_line * _per_line;
+}
+} // namespace __detail
+
+// One producer thread, one consumer thread. The block count is rounded
+// up to a power of two.
+template <typename _UnderlyingType, wait_policy _Wait = wait_policy::futex> class spsc_ring
+{
+  public:
+	using value_type = complex<_UnderlyingType>;
+
+  private:
+	std::size_t _mask, _block, _stride;
+	array<value_type> _slab;
+	array<std::size_t> _sizes;
+
+	// Consumer side: next block to read and the last tail it saw
+	alignas(__detail::__cache_line_size) std::atomic<std::size_t> _head{0};
+	std::size_t _tail_cache = 0;
+	// Producer side: next block to write and the last head it saw
+	alignas(__detail::__cache_line_size) std::atomic<std::size_t> _tail{0};
+	std::size_t _head_cache = 0;
+	std::atomic<bool> _closed{false};
+
+	__detail::__event<_Wait> _written, _freed;
+
+	inline value_type *
+	__slot(std::size_t _index) noexcept
+	{
+		return _slab.data() + (_index & _mask) * _stride;
+	}
+
+  public:
+	spsc_ring(std::size_t _blocks, std::size_t _block_size)
+		: _mask(std::bit_ceil(std::max<std::size_t>(_blocks, 1)) - 1), _block(_block_size),
+		  _stride(__detail::__block_stride<value_type>(_block_size)), _slab((_mask + 1) * _stride), _sizes(_mask + 1)
+	{
+	}
+	spsc_ring(const spsc_ring &) = delete;
+	spsc_ring &operator=(const spsc_ring &) = delete;
+
+	inline std::size_t
+	capacity() const noexcept
+	{
+		return _mask + 1;
+	}
+	inline std::size_t
+	block_size() const noexcept
+	{
+		return _block;
+	}
+
+	// Producer: the next free block, or an empty span when the ring is
+	// full. Reserving again without a commit returns the same block.
+	std::span<value_type>
+	try_reserve() noexcept
+	{
+		const std::size_t _t = _tail.load(std::memory_order_relaxed);
+		if (_t - _head_cache == capacity())
+		{
+			_head_cache = _head.load(std::memory_order_acquire);
+			if (_t - _head_cache == capacity())
+			{
+				return {};
+			}
+		}
+		return std::span<value_type>(__slot(_t), _block);
+	}
+	// Producer: waits for a free block
+	std::span<value_type>
+	reserve()
+	{
+		std::span<value_type> _s;
+		_freed.__wait([&] { return !(_s = try_reserve()).empty(); });
+		return _s;
+	}
+	// Producer: publishes the first _n (> 0) samples of the reserved block
+	void
+	commit(std::size_t _n)
+	{
+		assert(_n > 0 && _n <= _block);
+		const std::size_t _t = _tail.load(std::memory_order_relaxed);
+		_sizes[_t & _mask] = _n;
+		_tail.store(_t + 1, std::memory_order_release);
+		_written.__notify();
+	}
+	// Producer: no more blocks will be committed
+	void
+	close()
+	{
+		_closed.store(true, std::memory_order_release);
+		_written.__notify();
+	}
+
+	// Consumer: the oldest committed block, or an empty span when there
+	// is none. Acquiring again without a release returns the same block.
+	std::span<const value_type>
+	try_acquire() noexcept
+	{
+		const std::size_t _h = _head.load(std::memory_order_relaxed);
+		if (_h == _tail_cache)
+		{
+			_tail_cache = _tail.load(std::memory_order_acquire);
+			if (_h == _tail_cache)
+			{
+				return {};
+			}
+		}
+		return std::span<const value_type>(__slot(_h), _sizes[_h & _mask]);
+	}
+	// Consumer: waits for a block; empty once the ring is closed and
+	// drained
+	std::span<const value_type>
+	acquire()
+	{
+		std::span<const value_type> _s;
+		_written.__wait([&] { return !(_s = try_acquire()).empty() || _closed.load(std::memory_order_acquire); });
+		return _s.empty() ? try_acquire() : _s;
+	}
+	// Consumer: hands the acquired block back to the producer
+	void
+	release()
+	{
+		_head.store(_head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		_freed.__notify();
+	}
+};
+
+// Any number of producer and consumer threads (Vyukov's bounded queue
+// with a sequence number per block). The block count is rounded up to a
+// power of two.
+template <typename _UnderlyingType, wait_policy _Wait = wait_policy::futex> class mpmc_ring
+{
+  public:
+	using value_type = complex<_UnderlyingType>;
+
+	// A reserved or acquired block; false when none was available
+	template <typename _Tp> struct handle
+	{
+		std::span<_Tp> data;
+		std::size_t _ticket = static_cast<std::size_t>(-1);
+
+		explicit operator bool() const noexcept
+		{
+			return _ticket != static_cast<std::size_t>(-1);
+		}
+	};
+	using write_handle = handle<value_type>;
+	using read_handle = handle<const value_type>;
+
+  private:
+	struct alignas(__detail::__cache_line_size) __cell
+	{
+		std::atomic<std::size_t> _sequence;
+		std::size_t _size;
+	};
+
+	std::size_t _mask, _block, _stride;
+	array<value_type> _slab;
+	std::unique_ptr<__cell[]> _cells;
+
+	alignas(__detail::__cache_line_size) std::atomic<std::size_t> _enqueue{0};
+	alignas(__detail::__cache_line_size) std::atomic<std::size_t> _dequeue{0};
+	alignas(__detail::__cache_line_size) std::atomic<bool> _closed{false};
+
+	__detail::__event<_Wait> _written, _freed;
+
+	inline value_type *
+	__slot(std::size_t _ticket) noexcept
+	{
+		return _slab.data() + (_ticket & _mask) * _stride;
+	}
+
+  public:
+	mpmc_ring(std::size_t _blocks, std::size_t _block_size)
+		: _mask(std::bit_ceil(std::max<std::size_t>(_blocks, 1)) - 1), _block(_block_size),
+		  _stride(__detail::__block_stride<value_type>(_block_size)), _slab((_mask + 1) * _stride),
+		  _cells(new __cell[_mask + 1])
+	{
+		for (std::size_t _i = 0; _i <= _mask; ++_i)
+		{
+			_cells[_i]._sequence.store(_i, std::memory_order_relaxed);
+			_cells[_i]._size = 0;
+		}
+	}
+	mpmc_ring(const mpmc_ring &) = delete;
+	mpmc_ring &operator=(const mpmc_ring &) = delete;
+
+	inline std::size_t
+	capacity() const noexcept
+	{
+		return _mask + 1;
+	}
+	inline std::size_t
+	block_size() const noexcept
+	{
+		return _block;
+	}
+
+	// Producer: claims a free block. Every successful reserve must be
+	// followed by a commit, which later producers' blocks wait behind.
+	write_handle
+	try_reserve() noexcept
+	{
+		std::size_t _pos = _enqueue.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			__cell &_c = _cells[_pos & _mask];
+			const std::size_t _seq = _c._sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t _diff = static_cast<std::ptrdiff_t>(_seq - _pos);
+			if (_diff == 0)
+			{
+				if (_enqueue.compare_exchange_weak(_pos, _pos + 1, std::memory_order_relaxed))
+				{
+					return write_handle{std::span<value_type>(__slot(_pos), _block), _pos};
+				}
+			}
+			else if (_diff < 0)
+			{
+				return {};
+			}
+			else
+			{
+				_pos = _enqueue.load(std::memory_order_relaxed);
+			}
+		}
+	}
+	write_handle
+	reserve()
+	{
+		write_handle _h;
+		_freed.__wait([&] { return static_cast<bool>(_h = try_reserve()); });
+		return _h;
+	}
+	// Publishes the first _n samples of a reserved block
+	void
+	commit(const write_handle &_h, std::size_t _n)
+	{
+		assert(_h && _n <= _block);
+		__cell &_c = _cells[_h._ticket & _mask];
+		_c._size = _n;
+		_c._sequence.store(_h._ticket + 1, std::memory_order_release);
+		_written.__notify();
+	}
+	// No more blocks will be reserved. Call once every producer has
+	// committed its last block.
+	void
+	close()
+	{
+		_closed.store(true, std::memory_order_release);
+		_written.__notify();
+	}
+
+	// Consumer: claims the oldest committed block
+	read_handle
+	try_acquire() noexcept
+	{
+		std::size_t _pos = _dequeue.load(std::memory_order_relaxed);
+		for (;;)
+		{
+			__cell &_c = _cells[_pos & _mask];
+			const std::size_t _seq = _c._sequence.load(std::memory_order_acquire);
+			const std::ptrdiff_t _diff = static_cast<std::ptrdiff_t>(_seq - (_pos + 1));
+			if (_diff == 0)
+			{
+				if (_dequeue.compare_exchange_weak(_pos, _pos + 1, std::memory_order_relaxed))
+				{
+					return read_handle{std::span<const value_type>(__slot(_pos), _c._size), _pos};
+				}
+			}
+			else if (_diff < 0)
+			{
+				return {};
+			}
+			else
+			{
+				_pos = _dequeue.load(std::memory_order_relaxed);
+			}
+		}
+	}
+	// Waits for a block; false once the ring is closed and drained
+	read_handle
+	acquire()
+	{
+		read_handle _h;
+		_written.__wait([&]
+						{ return static_cast<bool>(_h = try_acquire()) || _closed.load(std::memory_order_acquire); });
+		return _h ? _h : try_acquire();
+	}
+	// Hands an acquired block back to the producers
+	void
+	release(const read_handle &_h)
+	{
+		assert(_h);
+		_cells[_h._ticket & _mask]._sequence.store(_h._ticket + _mask + 1, std::memory_order_release);
+		_freed.__notify();
+	}
+};
+} // namespace hypercomplex
+#endif // RING_HPP
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : ring.hpp
+// footer-end --------------------------------------------
@@ -6,11 +6,21 @@
 //
 // Created on  : 8/2/2025
 //
+// Comments:
+//      Sedenions, the 16 dimensional Cayley-Dickson algebra.
+//      Unlike the octonions they have zero divisors.
+//
 // header-end --------------------------------------------
 
 #ifndef SEDENION_HPP
 #define SEDENION_HPP
 
+#include "cayley_dickson.hpp"
+
+namespace hypercomplex
+{
+template <typename _UnderlyingType> using sedenion = cayley_dickson<_UnderlyingType, 16>;
+} // namespace hypercomplex
 #endif // SEDENION_HPP
 
 // footer-begin ------------------------------------------
@@ -6,11 +6,21 @@
 //
 // Created on  : 8/2/2025
 //
+// Comments:
+//      Trigintaduonions, the 32 dimensional Cayley-Dickson
+//      algebra.
+//
 // header-end --------------------------------------------
 
 #ifndef TRIGINTADUONION_HPP
 #define TRIGINTADUONION_HPP
 
+#include "cayley_dickson.hpp"
+
+namespace hypercomplex
+{
+template <typename _UnderlyingType> using trigintaduonion = cayley_dickson<_UnderlyingType, 32>;
+} // namespace hypercomplex
 #endif // TRIGINTADUONION_HPP
 
 // footer-begin ------------------------------------------
@@ -0,0 +1,36 @@
+// header-begin ------------------------------------------
+// File       : hypercomplex.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Explicit instantiations behind the hypercomplex
+//      library target. Everything linking the target is
+//      built with HYPERCOMPLEX_EXTERN_TEMPLATES, so these
+//      are the only copies of the complex functions and
+//      sequential batch kernels for float, double and
+//      long double.
+//
+// header-end --------------------------------------------
+
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/complex.hpp"
+
+namespace hypercomplex
+{
+__HYPERCOMPLEX_INSTANTIATE_COMPLEX(, float)
+__HYPERCOMPLEX_INSTANTIATE_COMPLEX(, double)
+__HYPERCOMPLEX_INSTANTIATE_COMPLEX(, long double)
+
+__HYPERCOMPLEX_INSTANTIATE_BATCH(, float)
+__HYPERCOMPLEX_INSTANTIATE_BATCH(, double)
+__HYPERCOMPLEX_INSTANTIATE_BATCH(, long double)
+} // namespace hypercomplex
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : hypercomplex.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,307 @@
+// header-begin ------------------------------------------
+// File       : batch_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/batch.hpp"
+
+#include <cmath>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+using hypercomplex::accuracy;
+using hypercomplex::complex;
+
+namespace
+{
+std::vector<complex<double>>
+spiral(std::size_t n)
+{
+  std::vector<complex<double>> v;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const double t = 0.37 * static_cast<double>(i) - 40.0;
+    v.emplace_back(std::exp(0.01 * t) * std::cos(t), std::exp(0.01 * t) * std::sin(t));
+  }
+  return v;
+}
+} // namespace
+
+//
+// to_polar
+//
+TEST(BatchPolar, ToPolarPreciseMatchesScalar)
+{
+  const auto in = spiral(257);
+  std::vector<double> mag(in.size()), phase(in.size());
+  hypercomplex::to_polar<double>(in, mag, phase);
+
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    EXPECT_DOUBLE_EQ(mag[i], abs(in[i]));
+    EXPECT_DOUBLE_EQ(phase[i], arg(in[i]));
+  }
+}
+
+TEST(BatchPolar, ToPolarFastWithinBound)
+{
+  const auto in = spiral(1000);
+  std::vector<double> mag(in.size()), phase(in.size());
+  hypercomplex::to_polar<double>(in, mag, phase, accuracy::fast);
+
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    EXPECT_NEAR(mag[i], abs(in[i]), 1e-14 * abs(in[i]));
+    EXPECT_NEAR(phase[i], arg(in[i]), 6.1e-4);
+  }
+}
+
+TEST(BatchPolar, ToPolarBalancedWithinBound)
+{
+  const auto in = spiral(1000);
+  std::vector<double> mag(in.size()), phase(in.size());
+  hypercomplex::to_polar<double>(in, mag, phase, accuracy::balanced);
+
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    EXPECT_NEAR(phase[i], arg(in[i]), 4e-8);
+  }
+}
+
+TEST(BatchPolar, ToPolarDoesNotOverflow)
+{
+  const std::vector<complex<float>> in{{3e30f, 4e30f}, {-3e-30f, 4e-30f}};
+  std::vector<float> mag(in.size()), phase(in.size());
+  hypercomplex::to_polar<float>(in, mag, phase, accuracy::fast);
+
+  EXPECT_FLOAT_EQ(mag[0], 5e30f);
+  EXPECT_FLOAT_EQ(mag[1], 5e-30f);
+}
+
+TEST(BatchPolar, ToPolarSpecialValues)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const std::vector<complex<double>> in{{0.0, 0.0}, {-0.0, 0.0}, {0.0, -0.0}, {-0.0, -0.0}, {inf, inf},
+                                        {-inf, 1.0}, {1.0, -inf},  {nan, inf},  {nan, 1.0},   {1.0, nan},
+                                        {nan, 0.0},  {-0.0, nan}, {inf, nan},  {nan, -inf}};
+  std::vector<double> mag(in.size()), phase(in.size());
+  hypercomplex::to_polar<double>(in, mag, phase, accuracy::fast);
+
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    const double ref_mag = std::hypot(in[i].real(), in[i].imag());
+    const double ref_phase = std::atan2(in[i].imag(), in[i].real());
+    if (std::isnan(ref_mag))
+      EXPECT_TRUE(std::isnan(mag[i])) << i;
+    else
+      EXPECT_EQ(mag[i], ref_mag) << i;
+    if (std::isnan(ref_phase))
+      EXPECT_TRUE(std::isnan(phase[i])) << i;
+    else
+    {
+      EXPECT_NEAR(phase[i], ref_phase, 6.1e-4) << i;
+      EXPECT_EQ(std::signbit(phase[i]), std::signbit(ref_phase)) << i;
+    }
+  }
+}
+
+//
+// from_polar
+//
+TEST(BatchPolar, FromPolarRoundTrip)
+{
+  const auto in = spiral(500);
+  std::vector<double> mag(in.size()), phase(in.size());
+  std::vector<complex<double>> out(in.size());
+
+  for (accuracy acc : {accuracy::fast, accuracy::balanced, accuracy::precise})
+  {
+    const double tol = acc == accuracy::fast ? 1e-4 : 1e-8;
+    hypercomplex::to_polar<double>(in, mag, phase, accuracy::precise);
+    hypercomplex::from_polar<double>(mag, phase, out, acc);
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      EXPECT_NEAR(out[i].real(), in[i].real(), tol * mag[i]);
+      EXPECT_NEAR(out[i].imag(), in[i].imag(), tol * mag[i]);
+    }
+  }
+}
+
+TEST(BatchPolar, FromPolarLargeArguments)
+{
+  std::vector<float> rho, theta;
+  for (int i = -200; i <= 200; ++i)
+  {
+    rho.push_back(2.0f);
+    theta.push_back(0.731f * static_cast<float>(i));
+  }
+  std::vector<complex<float>> out(rho.size());
+  hypercomplex::from_polar<float>(rho, theta, out, accuracy::balanced);
+
+  for (std::size_t i = 0; i < rho.size(); ++i)
+  {
+    EXPECT_NEAR(out[i].real(), 2.0 * std::cos(static_cast<double>(theta[i])), 2e-5);
+    EXPECT_NEAR(out[i].imag(), 2.0 * std::sin(static_cast<double>(theta[i])), 2e-5);
+  }
+}
+
+TEST(BatchPolar, FromPolarMatchesScalarPolarSpecialValues)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const std::vector<double> rho{0.0, 1.0, -1.0, inf, inf, nan, 1.0, 1.0};
+  const std::vector<double> theta{0.0, 0.0, 0.0, 0.0, inf, 0.0, nan, -inf};
+  std::vector<complex<double>> out(rho.size());
+  hypercomplex::from_polar<double>(rho, theta, out, accuracy::fast);
+
+  for (std::size_t i = 0; i < rho.size(); ++i)
+  {
+    const complex<double> ref = hypercomplex::polar(rho[i], theta[i]);
+    if (std::isnan(ref.real()))
+      EXPECT_TRUE(std::isnan(out[i].real())) << i;
+    else
+      EXPECT_EQ(out[i].real(), ref.real()) << i;
+    if (std::isnan(ref.imag()))
+      EXPECT_TRUE(std::isnan(out[i].imag())) << i;
+    else
+      EXPECT_EQ(out[i].imag(), ref.imag()) << i;
+  }
+}
+
+//
+// pow with a shared exponent
+//
+TEST(BatchPow, IntegerExponentMatchesScalar)
+{
+  const auto in = spiral(301);
+  std::vector<complex<double>> out(in.size());
+  for (int n : {0, 1, 2, 5, 12, -3})
+  {
+    hypercomplex::pow<double>(in, n, out);
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      const auto ref = pow(in[i], n);
+      ASSERT_EQ(out[i].real(), ref.real()) << n << " " << i;
+      ASSERT_EQ(out[i].imag(), ref.imag()) << n << " " << i;
+    }
+  }
+}
+
+TEST(BatchPow, RealExponentMatchesScalar)
+{
+  auto in = spiral(300);
+  in.push_back(complex<double>(0.0, 0.0));
+  std::vector<complex<double>> out(in.size()), fast(in.size());
+  hypercomplex::pow<double>(in, 0.37, out);
+  hypercomplex::pow<double>(in, 0.37, fast, accuracy::fast);
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    const auto ref = pow(in[i], 0.37);
+    EXPECT_EQ(out[i].real(), ref.real()) << i;
+    EXPECT_EQ(out[i].imag(), ref.imag()) << i;
+    EXPECT_LT(abs(fast[i] - ref), 1e-3 * (abs(ref) + 1e-300)) << i;
+  }
+
+  // An integral real exponent uses binary exponentiation
+  std::vector<complex<double>> squared(in.size());
+  hypercomplex::pow<double>(in, 2.0, out);
+  hypercomplex::pow<double>(in, 2, squared);
+  for (std::size_t i = 0; i < in.size(); ++i)
+    EXPECT_EQ(out[i], squared[i]) << i;
+}
+
+TEST(BatchPow, ComplexExponentMatchesScalar)
+{
+  auto in = spiral(300);
+  in.push_back(complex<double>(0.0, 0.0));
+  const complex<double> w(0.5, -0.25);
+  std::vector<complex<double>> out(in.size());
+  hypercomplex::pow<double>(in, w, out);
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    const auto ref = pow(in[i], w);
+    EXPECT_EQ(out[i].real(), ref.real()) << i;
+    EXPECT_EQ(out[i].imag(), ref.imag()) << i;
+  }
+}
+
+TEST(BatchPow, ZeroBaseMatchesScalar)
+{
+  // Every lane of a zero base takes the scalar pow()'s 0^w, at every
+  // accuracy level
+  const std::vector<complex<double>> in{complex<double>(0.0, 0.0), complex<double>(1.0, 1.0)};
+  const complex<double> exponents[]
+      = {{-1.0, 0.5}, {0.0, 0.5}, {2.0, -1.0}, {0.0, 0.0}, {-1.5, 0.0}, {0.5, 0.0}};
+  for (accuracy acc : {accuracy::fast, accuracy::balanced, accuracy::precise})
+  {
+    for (const auto &w : exponents)
+    {
+      std::vector<complex<double>> out(in.size());
+      hypercomplex::pow<double>(in, w, out, acc);
+      const auto ref = pow(in[0], w);
+      if (std::isnan(ref.real()))
+        EXPECT_TRUE(std::isnan(out[0].real())) << w.real() << " " << w.imag();
+      else
+        EXPECT_EQ(out[0].real(), ref.real()) << w.real() << " " << w.imag();
+      if (std::isnan(ref.imag()))
+        EXPECT_TRUE(std::isnan(out[0].imag())) << w.real() << " " << w.imag();
+      else
+        EXPECT_EQ(out[0].imag(), ref.imag()) << w.real() << " " << w.imag();
+    }
+  }
+}
+
+TEST(BatchPow, NegativeExponentStaysInRange)
+{
+  // |z|^n is out of float range although z^-n is not
+  const std::pair<complex<float>, int> cases[] = {{{100.0f, 1.0f}, -10}, {{1e-4f, 1e-6f}, -6}};
+  for (const auto &[z, n] : cases)
+  {
+    const std::vector<complex<float>> in(5, z);
+    std::vector<complex<float>> out(in.size()), real(in.size());
+    hypercomplex::pow<float>(in, n, out);
+    hypercomplex::pow<float>(in, static_cast<float>(n), real, accuracy::precise);
+    const auto ref = pow(z, n);
+    ASSERT_TRUE(std::isfinite(ref.real()) && ref.real() != 0.0f) << n;
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+      ASSERT_EQ(out[i], ref) << n << " " << i;
+      ASSERT_EQ(real[i], ref) << n << " " << i;
+    }
+  }
+}
+
+TEST(BatchPow, ParallelMatchesSequential)
+{
+  const auto in = spiral(20000);
+  std::vector<complex<double>> seq(in.size()), par(in.size());
+  hypercomplex::pow<double>(in, 7, seq);
+  hypercomplex::pow(hypercomplex::execution::par, std::span<const complex<double>>(in), 7, std::span(par));
+  EXPECT_EQ(seq, par);
+  hypercomplex::pow<double>(in, complex<double>(1.5, 0.5), seq, accuracy::balanced);
+  hypercomplex::pow(hypercomplex::execution::par, std::span<const complex<double>>(in), complex<double>(1.5, 0.5),
+                    std::span(par), accuracy::balanced);
+  EXPECT_EQ(seq, par);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : batch_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,108 @@
+// header-begin ------------------------------------------
+// File       : cayley_dickson_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/octonion.hpp"
+#include "hypercomplex/quaternion.hpp"
+#include "hypercomplex/sedenion.hpp"
+#include "hypercomplex/trigintaduonion.hpp"
+
+#include <cmath>
+#include <cstddef>
+
+using hypercomplex::cayley_dickson;
+using hypercomplex::octonion;
+using hypercomplex::quaternion;
+using hypercomplex::sedenion;
+using hypercomplex::trigintaduonion;
+
+namespace
+{
+template <std::size_t N>
+cayley_dickson<double, N>
+sample(double seed)
+{
+  cayley_dickson<double, N> z;
+  for (std::size_t i = 0; i < N; ++i)
+    z[i] = std::sin(seed * static_cast<double>(i + 1)) + 0.1 * static_cast<double>(i % 3);
+  return z;
+}
+
+template <std::size_t N>
+double
+distance(const cayley_dickson<double, N> &a, const cayley_dickson<double, N> &b)
+{
+  return abs(a - b);
+}
+} // namespace
+
+TEST(CayleyDickson, DimensionTwoAndFourMatchComplexAndQuaternion)
+{
+  const auto a = sample<4>(0.7), b = sample<4>(1.9);
+  const quaternion<double> qa(a[0], a[1], a[2], a[3]), qb(b[0], b[1], b[2], b[3]);
+  const auto p = a * b;
+  const auto q = qa * qb;
+  EXPECT_DOUBLE_EQ(p[0], q.w());
+  EXPECT_DOUBLE_EQ(p[1], q.x());
+  EXPECT_DOUBLE_EQ(p[2], q.y());
+  EXPECT_DOUBLE_EQ(p[3], q.z());
+
+  const cayley_dickson<double, 2> i({0.0, 1.0});
+  EXPECT_EQ(i * i, (cayley_dickson<double, 2>(-1.0)));
+}
+
+TEST(CayleyDickson, ImaginaryUnitsSquareToMinusOne)
+{
+  for (std::size_t k = 1; k < 32; ++k)
+  {
+    trigintaduonion<double> e;
+    e[k] = 1.0;
+    EXPECT_EQ(e * e, trigintaduonion<double>(-1.0)) << k;
+  }
+}
+
+TEST(CayleyDickson, OctonionsAreAlternativeAndNormed)
+{
+  const auto a = sample<8>(0.3), b = sample<8>(1.1);
+  EXPECT_LT(distance((a * a) * b, a * (a * b)), 1e-13);
+  EXPECT_LT(distance((b * a) * a, b * (a * a)), 1e-13);
+  EXPECT_NEAR(norm(a * b), norm(a) * norm(b), 1e-13);
+  // but not associative
+  const auto c = sample<8>(2.3);
+  EXPECT_GT(distance((a * b) * c, a * (b * c)), 1e-3);
+}
+
+TEST(CayleyDickson, ConjugateGivesNorm)
+{
+  const auto s = sample<16>(0.45);
+  const auto p = s * conj(s);
+  EXPECT_NEAR(p[0], norm(s), 1e-14);
+  for (std::size_t i = 1; i < 16; ++i)
+    EXPECT_NEAR(p[i], 0.0, 1e-14) << i;
+
+  // Sedenions have zero divisors: (e1 + e10)(e5 + e14) = 0
+  sedenion<double> x, y;
+  x[1] = x[10] = 1.0;
+  y[5] = y[14] = 1.0;
+  EXPECT_EQ(x * y, sedenion<double>());
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : cayley_dickson_tests.cpp
+// footer-end --------------------------------------------
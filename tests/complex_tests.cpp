@@ -13,6 +13,8 @@
 #include "hypercomplex/complex.hpp"
 
 #include <complex>
+#include <limits>
+#include <utility>
 
 using hypercomplex::complex;
 
@@ -551,6 +553,116 @@ TEST(ComplexTranscendentals, ConjNegRealNegImag)
   EXPECT_FLOAT_EQ(dut_res.imag(), ref_res.imag());
 }
 
+//
+// Exponentials and powers, checked against std::complex
+//
+TEST(ComplexTranscendentals, ExpLogRoundTrip)
+{
+  const complex<double> dut(-1.25, 2.5);
+  const std::complex<double> ref(-1.25, 2.5);
+
+  const auto e = exp(dut);
+  EXPECT_DOUBLE_EQ(e.real(), std::exp(ref).real());
+  EXPECT_DOUBLE_EQ(e.imag(), std::exp(ref).imag());
+  const auto l = log(dut);
+  EXPECT_DOUBLE_EQ(l.real(), std::log(ref).real());
+  EXPECT_DOUBLE_EQ(l.imag(), std::log(ref).imag());
+  const auto l10 = log10(dut);
+  EXPECT_DOUBLE_EQ(l10.real(), std::log10(ref).real());
+  EXPECT_DOUBLE_EQ(l10.imag(), std::log10(ref).imag());
+}
+TEST(ComplexTranscendentals, PowIntegerExponent)
+{
+  const complex<double> dut(0.9, -0.7);
+  const std::complex<double> ref(0.9, -0.7);
+  for (int n : {0, 1, 2, 3, 7, 16, 31, -1, -5})
+  {
+    const auto res = pow(dut, n);
+    std::complex<double> expected(1.0, 0.0);
+    for (int k = 0; k < std::abs(n); ++k)
+      expected *= ref;
+    if (n < 0)
+      expected = 1.0 / expected;
+    EXPECT_NEAR(res.real(), expected.real(), 1e-13 * std::abs(expected)) << n;
+    EXPECT_NEAR(res.imag(), expected.imag(), 1e-13 * std::abs(expected)) << n;
+  }
+  // Unsigned and extreme exponents take the same path
+  EXPECT_EQ(pow(complex<float>(0.0f, 1.0f), 4u), complex<float>(1.0f, 0.0f));
+  EXPECT_EQ(pow(complex<double>(1.0, 0.0), std::numeric_limits<long long>::min()), complex<double>(1.0, 0.0));
+}
+TEST(ComplexTranscendentals, PowNegativeExponentFloat)
+{
+  // |z|^n is far outside float range, z^-n is not: the base is inverted
+  // first, so neither the power nor its norm is ever formed
+  const std::pair<std::complex<double>, int> cases[] = {{{100.0, 1.0}, -10}, {{1e-4, 1e-6}, -6}, {{-3e-3, 2e-3}, -9}};
+  for (const auto &[z, n] : cases)
+  {
+    const complex<float> dut(static_cast<float>(z.real()), static_cast<float>(z.imag()));
+    const std::complex<double> expected
+        = std::pow(std::complex<double>(dut.real(), dut.imag()), static_cast<double>(n));
+    ASSERT_TRUE(std::abs(expected) > 1e19 || std::abs(expected) < 1e-19);
+    for (const auto &res : {pow(dut, n), pow(dut, static_cast<float>(n))})
+    {
+      EXPECT_NEAR(res.real(), expected.real(), 1e-5 * std::abs(expected)) << n;
+      EXPECT_NEAR(res.imag(), expected.imag(), 1e-5 * std::abs(expected)) << n;
+    }
+  }
+}
+TEST(ComplexTranscendentals, PowRealExponent)
+{
+  const complex<double> dut(-3.0, 4.0);
+  const std::complex<double> ref(-3.0, 4.0);
+  for (double x : {0.5, -1.5, 2.25, 3.0})
+  {
+    const auto res = pow(dut, x);
+    EXPECT_NEAR(res.real(), std::pow(ref, x).real(), 1e-12 * std::pow(5.0, x)) << x;
+    EXPECT_NEAR(res.imag(), std::pow(ref, x).imag(), 1e-12 * std::pow(5.0, x)) << x;
+  }
+  EXPECT_EQ(pow(complex<double>(0.0, 0.0), 0.5), complex<double>(0.0, 0.0));
+}
+TEST(ComplexTranscendentals, PowComplexExponent)
+{
+  const complex<double> z(1.5, -0.5), w(0.75, 1.25);
+  const std::complex<double> rz(1.5, -0.5), rw(0.75, 1.25);
+
+  const auto res = pow(z, w);
+  EXPECT_NEAR(res.real(), std::pow(rz, rw).real(), 1e-14);
+  EXPECT_NEAR(res.imag(), std::pow(rz, rw).imag(), 1e-14);
+  const auto base = pow(2.0, w);
+  EXPECT_NEAR(base.real(), std::pow(2.0, rw).real(), 1e-14);
+  EXPECT_NEAR(base.imag(), std::pow(2.0, rw).imag(), 1e-14);
+  const auto negative = pow(-2.0, w);
+  EXPECT_NEAR(negative.real(), std::pow(std::complex<double>(-2.0, 0.0), rw).real(), 1e-14);
+  EXPECT_NEAR(negative.imag(), std::pow(std::complex<double>(-2.0, 0.0), rw).imag(), 1e-14);
+  EXPECT_EQ(pow(complex<double>(), w), complex<double>());
+}
+TEST(ComplexTranscendentals, PowZeroBase)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  const complex<double> zero;
+
+  // 0^0 = 1, whichever overload
+  EXPECT_EQ(pow(zero, complex<double>()), complex<double>(1.0, 0.0));
+  EXPECT_EQ(pow(0.0, complex<double>()), complex<double>(1.0, 0.0));
+
+  // Re w > 0: zero
+  EXPECT_EQ(pow(zero, complex<double>(2.0, 3.0)), zero);
+  EXPECT_EQ(pow(0.0, complex<double>(0.5, -1.0)), zero);
+
+  // Re w < 0: infinite modulus, real when w is real
+  const auto real_exponent = pow(zero, complex<double>(-1.5, 0.0));
+  EXPECT_EQ(real_exponent.real(), inf);
+  EXPECT_EQ(real_exponent.imag(), 0.0);
+  const auto spiral = pow(0.0, complex<double>(-1.0, 2.0));
+  EXPECT_EQ(spiral.real(), inf);
+  EXPECT_TRUE(std::isnan(spiral.imag()));
+
+  // Re w = 0, Im w != 0: undefined
+  const auto undefined = pow(zero, complex<double>(0.0, 1.0));
+  EXPECT_TRUE(std::isnan(undefined.real()));
+  EXPECT_TRUE(std::isnan(undefined.imag()));
+}
+
 int
 main(int argc, char **argv)
 {
@@ -0,0 +1,53 @@
+// header-begin ------------------------------------------
+// File       : counters_disabled_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/counters.hpp"
+
+#include <sstream>
+
+using hypercomplex::complex;
+namespace counters = hypercomplex::counters;
+
+#if !defined(HYPERCOMPLEX_ENABLE_COUNTERS)
+static_assert(!counters::enabled);
+
+// Code written against the counters keeps compiling with them off and
+// sees nothing counted
+TEST(CountersDisabled, InterfaceCompilesAndReportsNothing)
+{
+  counters::reset();
+  complex<double> a(1.0, 2.0), b(3.0, -1.0);
+  const complex<double> c = a * b + a / b;
+  EXPECT_EQ(c.real(), 5.0 + 0.1);
+
+  EXPECT_EQ(counters::this_thread().flops(), 0u);
+  EXPECT_EQ(counters::total().flops(), 0u);
+  EXPECT_TRUE(counters::per_thread().empty());
+
+  std::ostringstream out;
+  counters::dump(out);
+  EXPECT_EQ(out.str(), "[total]\ntotal_flops 0\n");
+}
+#endif
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : counters_disabled_tests.cpp
+// footer-end --------------------------------------------
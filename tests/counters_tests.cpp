@@ -0,0 +1,123 @@
+// header-begin ------------------------------------------
+// File       : counters_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#ifndef HYPERCOMPLEX_ENABLE_COUNTERS
+#define HYPERCOMPLEX_ENABLE_COUNTERS
+#endif
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/counters.hpp"
+
+#include <sstream>
+#include <thread>
+#include <vector>
+
+using hypercomplex::complex;
+namespace counters = hypercomplex::counters;
+using counters::op;
+
+// Counting must not get in the way of constant evaluation
+static_assert((complex<float>(1.0f, 2.0f) * complex<float>(3.0f, 4.0f)).real() == -5.0f);
+
+TEST(Counters, CountsOperators)
+{
+  counters::reset();
+  const counters::snapshot before = counters::this_thread();
+
+  complex<double> a(1.0, 2.0), b(3.0, -1.0);
+  complex<double> c = a + b;
+  c = c * a;
+  c = c / b;
+  c *= 2.0;
+  c -= a;
+  (void)abs(c);
+  (void)arg(c);
+
+  const counters::snapshot d = counters::this_thread() - before;
+  EXPECT_EQ(d[op::add], 1u);
+  EXPECT_EQ(d[op::subtract], 1u);
+  EXPECT_EQ(d[op::multiply], 1u);
+  EXPECT_EQ(d[op::divide], 1u);
+  EXPECT_EQ(d[op::scalar_multiply], 1u);
+  EXPECT_EQ(d[op::abs], 1u);
+  EXPECT_EQ(d[op::arg], 1u);
+  EXPECT_EQ(d.flops(), 2u + 2u + 6u + 11u + 2u + 22u + 20u);
+}
+
+TEST(Counters, BatchKernelsCountPerElement)
+{
+  counters::reset();
+  std::vector<complex<float>> a(100, complex<float>(1.0f, 1.0f)), out(100);
+  std::vector<float> mag(100), phase(100);
+
+  hypercomplex::multiply<float>(a, a, out);
+  hypercomplex::to_polar<float>(out, mag, phase, hypercomplex::accuracy::fast);
+  hypercomplex::from_polar<float>(mag, phase, out, hypercomplex::accuracy::fast);
+
+  const counters::snapshot s = counters::this_thread();
+  EXPECT_EQ(s[op::multiply], 100u);
+  EXPECT_EQ(s[op::abs], 100u);
+  EXPECT_EQ(s[op::arg], 100u);
+  EXPECT_EQ(s[op::polar], 100u);
+}
+
+TEST(Counters, AggregatesAcrossThreads)
+{
+  counters::reset();
+  std::thread t(
+      []
+      {
+        complex<double> z(1.0, 1.0);
+        for (int i = 0; i < 10; ++i)
+          z = z * z;
+        // Still running, so it shows up as its own entry
+        bool found = false;
+        for (const auto &[id, s] : counters::per_thread())
+          found |= id == std::this_thread::get_id() && s[op::multiply] == 10u;
+        EXPECT_TRUE(found);
+      });
+  t.join();
+
+  (void)(complex<double>(1.0, 0.0) * complex<double>(0.0, 1.0));
+
+  // The exited thread's counts are folded into the total
+  EXPECT_EQ(counters::this_thread()[op::multiply], 1u);
+  EXPECT_EQ(counters::total()[op::multiply], 11u);
+
+  counters::reset();
+  EXPECT_EQ(counters::total()[op::multiply], 0u);
+}
+
+TEST(Counters, DumpListsNonZeroCounters)
+{
+  counters::reset();
+  (void)(complex<double>(1.0, 2.0) + complex<double>(3.0, 4.0));
+
+  std::ostringstream out;
+  counters::dump(out);
+  const std::string text = out.str();
+  EXPECT_NE(text.find("[total]\nadd 1 2\n"), std::string::npos) << text;
+  EXPECT_NE(text.find("total_flops 2\n"), std::string::npos) << text;
+  EXPECT_EQ(text.find("multiply"), std::string::npos) << text;
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : counters_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,215 @@
+// header-begin ------------------------------------------
+// File       : escape_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/escape.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <set>
+
+using hypercomplex::complex;
+using hypercomplex::escape_grid;
+using hypercomplex::escape_map;
+using hypercomplex::escape_options;
+using hypercomplex::matrix;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+// Plain scalar loop, same operation order as the engine
+template <typename T>
+std::uint32_t
+naive(escape_map map, complex<T> p, const escape_options<T> &o)
+{
+  T x = map == escape_map::mandelbrot ? T(0) : p.real();
+  T y = map == escape_map::mandelbrot ? T(0) : p.imag();
+  const T cr = map == escape_map::mandelbrot ? p.real() : o.julia_c.real();
+  const T ci = map == escape_map::mandelbrot ? p.imag() : o.julia_c.imag();
+  for (std::uint32_t it = 0; it < o.max_iterations; ++it)
+  {
+    const T x2 = x * x, y2 = y * y;
+    if (x2 + y2 > o.bailout * o.bailout)
+      return it;
+    const T nx = x2 - y2 + cr;
+    y = (x + x) * y + ci;
+    x = nx;
+  }
+  return o.max_iterations;
+}
+
+template <typename T>
+double
+mismatch(const matrix<std::uint32_t> &a, const matrix<std::uint32_t> &b)
+{
+  std::size_t bad = 0;
+  for (std::size_t i = 0; i < a.size(); ++i)
+    bad += a.data()[i] != b.data()[i];
+  return static_cast<double>(bad) / static_cast<double>(a.size());
+}
+
+const escape_grid<double> overview{complex<double>(-0.6, 0.0), 3.0 / 96, 97, 61};
+} // namespace
+
+TEST(EscapeTime, MandelbrotMatchesScalarLoop)
+{
+  escape_options<double> o;
+  o.max_iterations = 300;
+  o.interior_checks = false;
+  o.tile = 16;
+  matrix<std::uint32_t> counts;
+  hypercomplex::escape_time(overview, o, counts);
+
+  ASSERT_EQ(counts.rows(), overview.height);
+  ASSERT_EQ(counts.cols(), overview.width);
+  for (std::size_t r = 0; r < overview.height; ++r)
+    for (std::size_t c = 0; c < overview.width; ++c)
+      ASSERT_EQ(counts(r, c), naive(o.map, overview.at(r, c), o)) << r << " " << c;
+}
+
+TEST(EscapeTime, InteriorChecksOnlyShortcutInteriorPoints)
+{
+  escape_options<double> o;
+  o.max_iterations = 2000;
+  o.interior_checks = false;
+  matrix<std::uint32_t> plain, checked;
+  hypercomplex::escape_time(overview, o, plain);
+  o.interior_checks = true;
+  hypercomplex::escape_time(overview, o, checked);
+
+  EXPECT_LT(mismatch<double>(plain, checked), 0.002);
+}
+
+TEST(EscapeTime, JuliaMatchesScalarLoop)
+{
+  escape_options<float> o;
+  o.map = escape_map::julia;
+  o.julia_c = complex<float>(-0.8f, 0.156f);
+  o.max_iterations = 200;
+  o.interior_checks = false;
+  const escape_grid<float> grid{complex<float>(0.0f, 0.0f), 3.2f / 80, 80, 45};
+  matrix<std::uint32_t> counts;
+  hypercomplex::escape_time(execution::par, grid, o, counts);
+
+  for (std::size_t r = 0; r < grid.height; ++r)
+    for (std::size_t c = 0; c < grid.width; ++c)
+      ASSERT_EQ(counts(r, c), naive(o.map, grid.at(r, c), o)) << r << " " << c;
+}
+
+TEST(EscapeTime, NewtonConvergesToRoots)
+{
+  escape_options<double> o;
+  o.map = escape_map::newton;
+  o.max_iterations = 100;
+  const escape_grid<double> grid{complex<double>(0.1, 0.1), 0.05, 64, 64};
+  matrix<std::uint32_t> counts;
+  hypercomplex::escape_time(grid, o, counts);
+
+  std::size_t stuck = 0;
+  for (std::size_t i = 0; i < counts.size(); ++i)
+    stuck += counts.data()[i] == o.max_iterations;
+  EXPECT_LT(stuck, counts.size() / 100);
+  // A pixel on a root converges at once
+  const escape_grid<double> at_root{complex<double>(1.0, 0.0), 0.0, 1, 1};
+  hypercomplex::escape_time(at_root, o, counts);
+  EXPECT_EQ(counts(0, 0), 0u);
+}
+
+TEST(EscapeTime, SmoothCountTracksIterationCount)
+{
+  escape_options<double> o;
+  o.max_iterations = 500;
+  o.bailout = 256;
+  matrix<std::uint32_t> counts;
+  matrix<double> smooth;
+  hypercomplex::escape_time(overview, o, counts);
+  hypercomplex::escape_time(overview, o, smooth);
+
+  const double a = std::log2(std::log(256.0));
+  for (std::size_t i = 0; i < counts.size(); ++i)
+  {
+    const double n = counts.data()[i];
+    if (counts.data()[i] == o.max_iterations)
+      ASSERT_EQ(smooth.data()[i], n);
+    else
+    {
+      ASSERT_GE(smooth.data()[i], n - a - 1e-9);
+      ASSERT_LE(smooth.data()[i], n + 1 - a + 1e-9);
+    }
+  }
+}
+
+TEST(EscapeTime, ParallelTilesMatchSequential)
+{
+  hypercomplex::thread_pool pool(4);
+  escape_options<float> o;
+  o.max_iterations = 256;
+  o.tile = 8;
+  const escape_grid<float> grid{complex<float>(-0.75f, 0.1f), 0.004f, 203, 150};
+  matrix<float> seq, par;
+  hypercomplex::escape_time(execution::seq, grid, o, seq);
+  hypercomplex::escape_time(execution::par.on(pool), grid, o, par);
+  for (std::size_t i = 0; i < seq.size(); ++i)
+    ASSERT_EQ(seq.data()[i], par.data()[i]);
+}
+
+TEST(EscapeTime, PerturbationAgreesWithDirectIteration)
+{
+  escape_options<double> o;
+  o.max_iterations = 1000;
+  o.interior_checks = false;
+  matrix<std::uint32_t> direct, perturbed;
+  hypercomplex::escape_time(overview, o, direct);
+  o.perturbation = true;
+  hypercomplex::escape_time(overview, o, perturbed);
+  EXPECT_LT(mismatch<double>(direct, perturbed), 0.01);
+}
+
+TEST(EscapeTime, PerturbationResolvesDeepZooms)
+{
+  // Pixels 1e-17 apart are barely distinct in double near this center
+  const complex<double> center(-0.743643887037151, 0.131825904205330);
+  const double pixel = 1e-17;
+  const std::size_t side = 16;
+  escape_options<double> o;
+  o.max_iterations = 5000;
+  o.interior_checks = false;
+  const escape_grid<double> grid{center, pixel, side, side};
+  matrix<std::uint32_t> direct, perturbed;
+  hypercomplex::escape_time(grid, o, direct);
+  o.perturbation = true;
+  hypercomplex::escape_time(grid, o, perturbed);
+
+  // Reference: direct iteration in long double, which still resolves them
+  escape_options<long double> lo;
+  lo.max_iterations = o.max_iterations;
+  lo.interior_checks = false;
+  const escape_grid<long double> lgrid{complex<long double>(center.real(), center.imag()), pixel, side, side};
+  matrix<std::uint32_t> reference;
+  hypercomplex::escape_time(lgrid, lo, reference);
+
+  std::set<std::uint32_t> distinct(perturbed.begin(), perturbed.end());
+  EXPECT_GT(distinct.size(), 2u);
+  EXPECT_LT(mismatch<double>(perturbed, reference), 0.05);
+  EXPECT_GT(mismatch<double>(direct, reference), 0.5);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : escape_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,144 @@
+// header-begin ------------------------------------------
+// File       : execution_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/execution.hpp"
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::thread_pool;
+namespace execution = hypercomplex::execution;
+
+//
+// thread_pool
+//
+TEST(ThreadPool, EveryIndexRunsExactlyOnce)
+{
+  thread_pool pool(4);
+  std::vector<std::atomic<int>> hits(100000);
+  pool.parallel_for(0, hits.size(), [&](std::size_t b, std::size_t e) {
+    for (std::size_t i = b; i < e; ++i)
+      hits[i].fetch_add(1);
+  }, 1000);
+
+  for (const auto &h : hits)
+    ASSERT_EQ(h.load(), 1);
+}
+
+TEST(ThreadPool, SmallRangesRunInline)
+{
+  thread_pool pool(4);
+  std::thread::id ran_on;
+  std::size_t calls = 0;
+  pool.parallel_for(0, 100, [&](std::size_t, std::size_t) {
+    ran_on = std::this_thread::get_id();
+    ++calls;
+  }, 1000);
+
+  EXPECT_EQ(calls, 1u);
+  EXPECT_EQ(ran_on, std::this_thread::get_id());
+  EXPECT_EQ(pool.chunks(100, 1000), 1u);
+  EXPECT_LE(pool.chunks(1u << 30, 1000), 4 * pool.size());
+}
+
+TEST(ThreadPool, NestedParallelForCompletes)
+{
+  thread_pool pool(3);
+  std::atomic<std::size_t> total{0};
+  pool.parallel_for(0, 16, [&](std::size_t b, std::size_t e) {
+    for (std::size_t i = b; i < e; ++i)
+      pool.parallel_for(0, 64, [&](std::size_t ib, std::size_t ie) { total += ie - ib; }, 8);
+  }, 1);
+
+  EXPECT_EQ(total.load(), 16u * 64u);
+}
+
+TEST(ThreadPool, ExceptionsReachTheCaller)
+{
+  thread_pool pool(2);
+  EXPECT_THROW(pool.parallel_for(0, 64, [](std::size_t b, std::size_t) {
+    if (b == 0)
+      throw std::runtime_error("chunk failed");
+  }, 1), std::runtime_error);
+}
+
+//
+// Policy overloads
+//
+TEST(ExecutionPolicies, ArithmeticMatchesSequential)
+{
+  thread_pool pool(4);
+  const std::size_t n = 100003;
+  std::vector<complex<float>> a(n), b(n), seq(n), par(n), unseq(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    a[i] = complex<float>(0.5f * static_cast<float>(i % 97), -1.0f + static_cast<float>(i % 13));
+    b[i] = complex<float>(1.0f + static_cast<float>(i % 7), 0.25f * static_cast<float>(i % 5));
+  }
+
+  hypercomplex::multiply<float>(a, b, seq);
+  hypercomplex::multiply(execution::par.on(pool), std::span<const complex<float>>(a), b, std::span(par));
+  hypercomplex::multiply(execution::par_unseq.on(pool), std::span<const complex<float>>(a), b, std::span(unseq));
+
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    ASSERT_EQ(par[i], seq[i]);
+    ASSERT_EQ(unseq[i], seq[i]);
+  }
+
+  hypercomplex::add(execution::par, std::span<const complex<float>>(a), b, std::span(par));
+  hypercomplex::subtract(execution::seq, std::span<const complex<float>>(par), b, std::span(unseq));
+  hypercomplex::divide(execution::par.on(pool), std::span<const complex<float>>(a), b, std::span(par));
+  hypercomplex::divide<float>(a, b, seq);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    ASSERT_EQ(unseq[i], a[i]);
+    ASSERT_EQ(par[i], seq[i]);
+  }
+}
+
+TEST(ExecutionPolicies, PolarConversionMatchesSequential)
+{
+  thread_pool pool(4);
+  const std::size_t n = 50000;
+  std::vector<complex<double>> in(n), back(n);
+  for (std::size_t i = 0; i < n; ++i)
+    in[i] = complex<double>(std::cos(0.001 * i) * i, std::sin(0.003 * i) - 0.5);
+
+  std::vector<double> mag_seq(n), phase_seq(n), mag_par(n), phase_par(n);
+  hypercomplex::to_polar<double>(in, mag_seq, phase_seq, hypercomplex::accuracy::fast);
+  hypercomplex::to_polar(execution::par.on(pool), std::span<const complex<double>>(in), std::span(mag_par),
+                         std::span(phase_par), hypercomplex::accuracy::fast);
+  EXPECT_EQ(mag_par, mag_seq);
+  EXPECT_EQ(phase_par, phase_seq);
+
+  hypercomplex::from_polar(execution::par_unseq.on(pool), std::span<const double>(mag_par),
+                           std::span<const double>(phase_par), std::span(back));
+  for (std::size_t i = 0; i < n; ++i)
+    ASSERT_NEAR(back[i].real(), in[i].real(), 1e-3 * (1.0 + mag_seq[i]));
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : execution_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,107 @@
+// header-begin ------------------------------------------
+// File       : finite_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/finite.hpp"
+
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <random>
+#include <vector>
+
+using hypercomplex::accuracy;
+using hypercomplex::complex;
+namespace finite_math = hypercomplex::finite_math;
+
+namespace
+{
+std::vector<complex<double>>
+samples()
+{
+  std::mt19937_64 rng(46);
+  std::uniform_real_distribution<double> u(-4.0, 4.0);
+  std::vector<complex<double>> v{{0.0, 0.0}, {-2.0, 0.0}, {-2.0, -0.0}, {0.0, 3.0}, {1e-3, -1e-3}};
+  for (int i = 0; i < 1000; ++i)
+    v.emplace_back(u(rng), u(rng));
+  return v;
+}
+
+// Relative to max(|expected|, 1)
+void
+expect_close(const complex<double> &got, const std::complex<double> &expected, double tolerance)
+{
+  const double scale = std::max(std::abs(expected), 1.0);
+  EXPECT_NEAR(got.real(), expected.real(), tolerance * scale);
+  EXPECT_NEAR(got.imag(), expected.imag(), tolerance * scale);
+}
+} // namespace
+
+TEST(Finite, MatchesStdComplex)
+{
+  for (const auto &z : samples())
+  {
+    const std::complex<double> s(z.real(), z.imag());
+    EXPECT_NEAR(finite_math::abs(z), std::abs(s), 1e-15 * std::abs(s));
+    expect_close(finite_math::exp(z), std::exp(s), 1e-14);
+    expect_close(finite_math::sqrt(z), std::sqrt(s), 1e-15);
+    expect_close(finite_math::sin(z), std::sin(s), 1e-13);
+    expect_close(finite_math::cos(z), std::cos(s), 1e-13);
+    expect_close(finite_math::sinh(z), std::sinh(s), 1e-13);
+    expect_close(finite_math::cosh(z), std::cosh(s), 1e-13);
+    if (z != complex<double>())
+    {
+      EXPECT_NEAR(finite_math::arg(z), std::arg(s), 1e-15);
+      expect_close(finite_math::log(z), std::log(s), 1e-15);
+      expect_close(finite_math::pow(z, 2.5), std::pow(s, 2.5), 1e-13);
+    }
+  }
+  // A negative radius is not folded into the angle
+  const auto p = finite_math::polar(-2.0, 0.5);
+  EXPECT_DOUBLE_EQ(p.real(), -2.0 * std::cos(0.5));
+  EXPECT_DOUBLE_EQ(p.imag(), -2.0 * std::sin(0.5));
+}
+
+TEST(Finite, ApproximateAccuracies)
+{
+  for (const auto &z : samples())
+  {
+    const std::complex<double> s(z.real(), z.imag());
+    expect_close(finite_math::exp<accuracy::balanced>(z), std::exp(s), 1e-8);
+    expect_close(finite_math::exp<accuracy::fast>(z), std::exp(s), 1e-3);
+    expect_close(finite_math::polar<accuracy::balanced>(z.real(), z.imag()), std::polar(1.0, z.imag()) * z.real(), 1e-8);
+    if (z != complex<double>())
+    {
+      EXPECT_NEAR(finite_math::arg<accuracy::balanced>(z), std::arg(s), 1e-7);
+    }
+  }
+}
+
+#ifndef NDEBUG
+TEST(FiniteDeathTest, AssertsOnNonFiniteInput)
+{
+  const double inf = std::numeric_limits<double>::infinity();
+  EXPECT_DEATH(finite_math::exp(complex<double>(inf, 0.0)), "not finite");
+  EXPECT_DEATH(finite_math::polar(1.0, std::nan("")), "not finite");
+}
+#endif
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : finite_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,143 @@
+// header-begin ------------------------------------------
+// File       : hypercomplex_view_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/hypercomplex_view.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+using hypercomplex::cayley_dickson;
+using hypercomplex::complex;
+using hypercomplex::hypercomplex_view;
+using hypercomplex::quaternion;
+
+namespace
+{
+std::vector<double>
+components(std::size_t n, double seed)
+{
+  std::vector<double> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = std::cos(seed * static_cast<double>(i) + 0.3) * (1.0 + static_cast<double>(i % 7));
+  return v;
+}
+
+template <std::size_t N>
+void
+expect_matches_static_type(std::size_t count)
+{
+  const auto a = components(count * N, 0.37), b = components(count * N, 1.21);
+  std::vector<double> out(count * N);
+  hypercomplex::multiply<double>(hypercomplex_view<const double>(a, N), hypercomplex_view<const double>(b, N),
+                                 hypercomplex_view<double>(out, N));
+  for (std::size_t e = 0; e < count; ++e)
+  {
+    const double *x = a.data() + e * N, *y = b.data() + e * N;
+    if constexpr (N == 2)
+    {
+      const auto r = complex<double>(x[0], x[1]) * complex<double>(y[0], y[1]);
+      ASSERT_EQ(out[e * 2], r.real());
+      ASSERT_EQ(out[e * 2 + 1], r.imag());
+    }
+    else if constexpr (N == 4)
+    {
+      const auto r = quaternion<double>(x[0], x[1], x[2], x[3]) * quaternion<double>(y[0], y[1], y[2], y[3]);
+      ASSERT_EQ(out[e * 4], r.w());
+      ASSERT_EQ(out[e * 4 + 3], r.z());
+    }
+    else
+    {
+      cayley_dickson<double, N> p, q;
+      for (std::size_t k = 0; k < N; ++k)
+      {
+        p[k] = x[k];
+        q[k] = y[k];
+      }
+      const auto r = p * q;
+      for (std::size_t k = 0; k < N; ++k)
+        ASSERT_EQ(out[e * N + k], r[k]) << N << " " << e << " " << k;
+    }
+  }
+}
+} // namespace
+
+TEST(HypercomplexView, RejectsUnsupportedShapes)
+{
+  std::vector<double> v(24);
+  EXPECT_THROW(hypercomplex_view<double>(v, 3), std::invalid_argument);
+  EXPECT_THROW(hypercomplex_view<double>(v, 16), std::invalid_argument);
+  const hypercomplex_view<double> view(v, 8);
+  EXPECT_EQ(view.size(), 3u);
+  EXPECT_EQ(view[2].data(), v.data() + 16);
+}
+
+TEST(HypercomplexView, MultiplyMatchesStaticTypes)
+{
+  expect_matches_static_type<2>(33);
+  expect_matches_static_type<4>(33);
+  expect_matches_static_type<8>(33);
+  expect_matches_static_type<16>(9);
+  expect_matches_static_type<32>(5);
+}
+
+TEST(HypercomplexView, ConjugateNormAndInPlaceProduct)
+{
+  for (std::size_t dim : {2u, 4u, 8u, 16u, 32u})
+  {
+    const std::size_t count = 6;
+    auto a = components(count * dim, 0.9);
+    std::vector<double> c(a.size()), norms(count);
+    hypercomplex::conj<double>(hypercomplex_view<const double>(a, dim), hypercomplex_view<double>(c, dim));
+    hypercomplex::norm<double>(hypercomplex_view<const double>(a, dim), std::span(norms));
+
+    // z * conj(z) = |z|^2, computed in place
+    const hypercomplex_view<double> va(a, dim);
+    hypercomplex::multiply<double>(va, hypercomplex_view<const double>(c, dim), va);
+    for (std::size_t e = 0; e < count; ++e)
+    {
+      EXPECT_NEAR(va[e][0], norms[e], 1e-12 * norms[e]) << dim;
+      for (std::size_t k = 1; k < dim; ++k)
+        EXPECT_NEAR(va[e][k], 0.0, 1e-12 * norms[e]) << dim << " " << k;
+    }
+  }
+}
+
+TEST(HypercomplexView, ParallelMatchesSequential)
+{
+  const std::size_t dim = 8, count = 5000;
+  const auto a = components(count * dim, 0.11), b = components(count * dim, 0.53);
+  std::vector<double> seq(a.size()), par(a.size());
+  const hypercomplex_view<const double> va(a, dim), vb(b, dim);
+  hypercomplex::multiply<double>(va, vb, hypercomplex_view<double>(seq, dim));
+  hypercomplex::multiply(hypercomplex::execution::par, va, vb, hypercomplex_view<double>(par, dim));
+  EXPECT_EQ(seq, par);
+
+  hypercomplex::add<double>(va, vb, hypercomplex_view<double>(seq, dim));
+  hypercomplex::subtract(hypercomplex::execution::par, hypercomplex_view<const double>(seq, dim), vb,
+                         hypercomplex_view<double>(par, dim));
+  for (std::size_t i = 0; i < a.size(); ++i)
+    ASSERT_NEAR(par[i], a[i], 1e-12) << i;
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : hypercomplex_view_tests.cpp
+// footer-end --------------------------------------------
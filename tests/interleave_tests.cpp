@@ -0,0 +1,118 @@
+// header-begin ------------------------------------------
+// File       : interleave_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/interleave.hpp"
+
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using hypercomplex::complex;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+std::vector<complex<double>>
+ramp(std::size_t n)
+{
+  std::vector<complex<double>> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = complex<double>(static_cast<double>(i), -0.5 * static_cast<double>(i) - 1.0);
+  return v;
+}
+} // namespace
+
+TEST(Interleave, AsScalarsViewsTheStorage)
+{
+  auto v = ramp(5);
+  const std::span<double> s = hypercomplex::as_scalars(std::span(v));
+  ASSERT_EQ(s.size(), 10u);
+  EXPECT_EQ(s[6], 3.0);
+  EXPECT_EQ(s[7], -2.5);
+  s[8] = 42.0;
+  EXPECT_EQ(v[4].real(), 42.0);
+
+  const std::span<const double> c = hypercomplex::as_scalars(std::span<const complex<double>>(v));
+  EXPECT_EQ(c.data(), s.data());
+  EXPECT_EQ(c.size(), 10u);
+}
+
+TEST(Interleave, SplitAndInterleaveRoundTrip)
+{
+  for (std::size_t n : {0u, 1u, 7u, 1000u, 40001u})
+  {
+    const auto v = ramp(n);
+    std::vector<double> re(n), im(n);
+    hypercomplex::deinterleave(std::span<const complex<double>>(v), std::span(re), std::span(im));
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      ASSERT_EQ(re[i], v[i].real());
+      ASSERT_EQ(im[i], v[i].imag());
+    }
+
+    std::vector<complex<double>> back(n);
+    hypercomplex::thread_pool pool(3);
+    hypercomplex::interleave(execution::par.on(pool), std::span<const double>(re), std::span<const double>(im),
+                             std::span(back));
+    EXPECT_EQ(back, v) << n;
+  }
+}
+
+TEST(Interleave, InPlaceBlockedLayout)
+{
+  // 10 numbers in blocks of 4: two full blocks and one of 2
+  auto v = ramp(10);
+  const auto original = v;
+  hypercomplex::deinterleave_in_place(std::span(v), 4);
+  const std::span<const double> s = hypercomplex::as_scalars(std::span<const complex<double>>(v));
+  for (std::size_t b = 0; b < 3; ++b)
+  {
+    const std::size_t begin = 4 * b, len = b < 2 ? 4 : 2;
+    for (std::size_t i = 0; i < len; ++i)
+    {
+      EXPECT_EQ(s[2 * begin + i], original[begin + i].real());
+      EXPECT_EQ(s[2 * begin + len + i], original[begin + i].imag());
+    }
+  }
+  hypercomplex::interleave_in_place(std::span(v), 4);
+  EXPECT_EQ(v, original);
+}
+
+TEST(Interleave, InPlaceParallelMatchesSequential)
+{
+  auto a = ramp(100003);
+  auto b = a;
+  const auto original = a;
+  hypercomplex::thread_pool pool(4);
+  hypercomplex::deinterleave_in_place(std::span(a));
+  hypercomplex::deinterleave_in_place(execution::par.on(pool), std::span(b));
+  EXPECT_EQ(a, b);
+  hypercomplex::interleave_in_place(execution::par.on(pool), std::span(b));
+  EXPECT_EQ(b, original);
+
+  EXPECT_THROW(hypercomplex::deinterleave_in_place(std::span(a), 0), std::invalid_argument);
+  EXPECT_THROW(hypercomplex::interleave_in_place(std::span(a), hypercomplex::max_interleave_block + 1),
+               std::invalid_argument);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : interleave_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,98 @@
+// header-begin ------------------------------------------
+// File       : interop_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/interop.hpp"
+
+#include <complex>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using hypercomplex::complex;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+// Stands in for cuda::std::complex, which is aligned to its full size
+struct alignas(16) aligned_pair
+{
+  double re, im;
+};
+} // namespace
+
+template <> struct hypercomplex::complex_layout<aligned_pair> : std::true_type
+{
+  using value_type = double;
+};
+
+static_assert(hypercomplex::is_layout_compatible_v<const complex<double>, std::complex<double>>);
+static_assert(hypercomplex::is_layout_compatible_v<aligned_pair, complex<double>>);
+static_assert(!hypercomplex::is_layout_compatible_v<complex<float>, std::complex<double>>);
+static_assert(!hypercomplex::is_layout_compatible_v<double, complex<double>>);
+
+TEST(Interop, ReinterpretSpanSharesStorage)
+{
+  std::vector<std::complex<double>> s{{1.0, 2.0}, {3.0, -4.0}};
+  const std::span<complex<double>> h = hypercomplex::reinterpret_span<complex<double>>(std::span(s));
+  ASSERT_EQ(h.size(), 2u);
+  EXPECT_EQ(static_cast<const void *>(h.data()), static_cast<const void *>(s.data()));
+  EXPECT_EQ(h[1], complex<double>(3.0, -4.0));
+  h[0] = complex<double>(5.0, 6.0);
+  EXPECT_EQ(s[0], std::complex<double>(5.0, 6.0));
+
+  const std::span<const std::complex<double>> back =
+    hypercomplex::reinterpret_span<const std::complex<double>>(std::span<const complex<double>>(h));
+  EXPECT_EQ(back[1], std::complex<double>(3.0, -4.0));
+}
+
+TEST(Interop, ReinterpretSpanChecksAlignment)
+{
+  // complex<double> is only 8-byte aligned, so it may start half way
+  // into a 16-byte aligned_pair slot
+  alignas(16) double storage[10] = {};
+  const std::span<complex<double>> even(reinterpret_cast<complex<double> *>(storage), 4);
+  const std::span<complex<double>> odd(reinterpret_cast<complex<double> *>(storage + 1), 4);
+  EXPECT_EQ(hypercomplex::reinterpret_span<aligned_pair>(even).size(), 4u);
+  EXPECT_THROW(hypercomplex::reinterpret_span<aligned_pair>(odd), std::invalid_argument);
+}
+
+TEST(Interop, ConvertBetweenScalarTypes)
+{
+  std::vector<std::complex<double>> in(10001);
+  for (std::size_t i = 0; i < in.size(); ++i)
+    in[i] = std::complex<double>(0.25 * static_cast<double>(i), 1.0 / (1.0 + static_cast<double>(i)));
+
+  std::vector<complex<float>> narrow(in.size());
+  hypercomplex::thread_pool pool(3);
+  hypercomplex::convert(execution::par.on(pool), std::span<const std::complex<double>>(in), std::span(narrow));
+  std::vector<std::complex<double>> wide(in.size());
+  hypercomplex::convert(std::span<const complex<float>>(narrow), std::span(wide));
+  for (std::size_t i = 0; i < in.size(); ++i)
+  {
+    ASSERT_EQ(narrow[i].real(), static_cast<float>(in[i].real()));
+    ASSERT_EQ(narrow[i].imag(), static_cast<float>(in[i].imag()));
+    ASSERT_EQ(wide[i], std::complex<double>(narrow[i].real(), narrow[i].imag()));
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : interop_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,151 @@
+// header-begin ------------------------------------------
+// File       : lu_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/lu.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::lu_decomposition;
+using hypercomplex::matrix;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+matrix<complex<double>>
+test_matrix(std::size_t n)
+{
+  // Random entries: well conditioned, but without the diagonal
+  // dominance that would make pivoting unnecessary
+  std::mt19937_64 rng(n);
+  std::uniform_real_distribution<double> u(-1.0, 1.0);
+  matrix<complex<double>> a(n, n);
+  for (auto &z : a)
+    z = complex<double>(u(rng), u(rng));
+  return a;
+}
+
+// max |(A x - b)_i|
+double
+residual(const matrix<complex<double>> &a, std::span<const complex<double>> x, std::span<const complex<double>> b)
+{
+  double worst = 0;
+  for (std::size_t r = 0; r < a.rows(); ++r)
+  {
+    complex<double> s = -b[r];
+    for (std::size_t c = 0; c < a.cols(); ++c)
+      s += a(r, c) * x[c];
+    worst = std::max(worst, std::hypot(s.real(), s.imag()));
+  }
+  return worst;
+}
+} // namespace
+
+TEST(LU, SolvesAcrossSeveralBlocks)
+{
+  const std::size_t n = 203;
+  const auto a = test_matrix(n);
+  std::vector<complex<double>> b(n);
+  for (std::size_t i = 0; i < n; ++i)
+    b[i] = complex<double>(1.0 / (1.0 + i), static_cast<double>(i % 7));
+
+  const lu_decomposition<double> lu(a);
+  EXPECT_FALSE(lu.singular());
+  std::vector<complex<double>> x = b;
+  lu.solve(std::span(x));
+  EXPECT_LT(residual(a, x, b), 1e-9);
+}
+
+TEST(LU, PivotsPastAZeroDiagonal)
+{
+  matrix<complex<double>> a(2, 2);
+  a(0, 1) = complex<double>(2.0, 0.0);
+  a(1, 0) = complex<double>(0.0, 1.0);
+  a(1, 1) = complex<double>(1.0, 0.0);
+  const lu_decomposition<double> lu(a);
+  EXPECT_EQ(lu.pivots()[0], 1u);
+  std::vector<complex<double>> x{{2.0, 0.0}, {1.0, 1.0}};
+  lu.solve(std::span(x));
+  // x1 = 1, i x0 + 1 = 1 + i
+  EXPECT_NEAR(x[0].real(), 1.0, 1e-15);
+  EXPECT_NEAR(x[0].imag(), 0.0, 1e-15);
+  EXPECT_NEAR(x[1].real(), 1.0, 1e-15);
+}
+
+TEST(LU, ParallelMatchesSequentialAndSolveMany)
+{
+  const std::size_t n = 150, k = 9;
+  const auto a = test_matrix(n);
+  hypercomplex::thread_pool pool(4);
+  const lu_decomposition<double> seq(a);
+  const lu_decomposition<double> par(execution::par.on(pool), a);
+  EXPECT_TRUE(std::equal(seq.factors().begin(), seq.factors().end(), par.factors().begin()));
+
+  matrix<complex<double>> b(n, k);
+  for (std::size_t r = 0; r < n; ++r)
+    for (std::size_t c = 0; c < k; ++c)
+      b(r, c) = complex<double>(static_cast<double>(r + c), static_cast<double>(c) - 0.5 * r);
+  matrix<complex<double>> x = b;
+  par.solve_many(execution::par.on(pool), x);
+  for (std::size_t c = 0; c < k; ++c)
+  {
+    std::vector<complex<double>> column(n), expected(n);
+    for (std::size_t r = 0; r < n; ++r)
+    {
+      column[r] = x(r, c);
+      expected[r] = b(r, c);
+    }
+    EXPECT_LT(residual(a, column, expected), 1e-9) << c;
+    seq.solve(std::span(expected));
+    for (std::size_t r = 0; r < n; ++r)
+      ASSERT_NEAR(std::hypot((expected[r] - column[r]).real(), (expected[r] - column[r]).imag()), 0.0, 1e-11);
+  }
+}
+
+TEST(LU, RejectsBadInput)
+{
+  EXPECT_THROW(lu_decomposition<double>(matrix<complex<double>>(3, 4)), std::invalid_argument);
+
+  matrix<complex<double>> a(3, 3);
+  for (std::size_t c = 0; c < 3; ++c)
+  {
+    a(0, c) = complex<double>(1.0 + c, 0.0);
+    a(1, c) = complex<double>(2.0 + 2.0 * c, 0.0);
+    a(2, c) = complex<double>(0.0, 1.0 * c);
+  }
+  const lu_decomposition<double> lu(a);
+  EXPECT_TRUE(lu.singular());
+  std::vector<complex<double>> b(3);
+  EXPECT_THROW(lu.solve(std::span(b)), std::invalid_argument);
+
+  const lu_decomposition<double> ok(test_matrix(3));
+  std::vector<complex<double>> wrong(4);
+  EXPECT_THROW(ok.solve(std::span(wrong)), std::invalid_argument);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : lu_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,174 @@
+// header-begin ------------------------------------------
+// File       : memory_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/array.hpp"
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/memory.hpp"
+
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+
+using hypercomplex::arena;
+using hypercomplex::complex;
+
+namespace
+{
+// Upstream resource that counts the allocations passed through it
+class counting_resource : public std::pmr::memory_resource
+{
+public:
+  std::size_t allocations = 0;
+
+private:
+  void *
+  do_allocate(std::size_t bytes, std::size_t alignment) override
+  {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void
+  do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+  {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+  }
+  bool
+  do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+bool
+aligned_to(const void *p, std::size_t alignment)
+{
+  return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+} // namespace
+
+//
+// aligned_allocator
+//
+TEST(AlignedAllocator, DefaultContainersAreCacheLineAligned)
+{
+  hypercomplex::array<complex<float>> dut(3);
+  hypercomplex::matrix<complex<double>> mat(5, 3);
+
+  EXPECT_TRUE(aligned_to(dut.data(), 64));
+  EXPECT_TRUE(aligned_to(mat.data(), 64));
+}
+
+//
+// arena
+//
+TEST(Arena, AllocationsAreAlignedAndBumped)
+{
+  arena dut(1024);
+  void *a = dut.allocate(3, 1);
+  void *b = dut.allocate(16, 32);
+
+  EXPECT_TRUE(aligned_to(b, 32));
+  EXPECT_GT(b, a);
+  EXPECT_GE(dut.used(), 3u + 16u);
+}
+
+TEST(Arena, ThrowsInsteadOfGrowing)
+{
+  arena dut(256);
+  (void)dut.allocate(200, 8);
+  EXPECT_THROW((void)dut.allocate(100, 8), std::bad_alloc);
+}
+
+TEST(Arena, ScopeRewindsAndHighWaterIsKept)
+{
+  arena dut(4096);
+  (void)dut.allocate(64, 64);
+  {
+    arena::scope guard(dut);
+    auto scratch = dut.allocate_span<complex<double>>(100);
+    EXPECT_EQ(scratch.size(), 100u);
+    EXPECT_TRUE(aligned_to(scratch.data(), 64));
+  }
+  EXPECT_EQ(dut.used(), 64u);
+  EXPECT_GE(dut.high_water(), 64u + 100u * sizeof(complex<double>));
+
+  dut.reset();
+  EXPECT_EQ(dut.used(), 0u);
+}
+
+TEST(Arena, CallerProvidedStorage)
+{
+  alignas(64) std::byte storage[512];
+  arena dut(storage, sizeof(storage));
+  auto span = dut.allocate_span<float>(16);
+
+  EXPECT_GE(reinterpret_cast<std::byte *>(span.data()), storage);
+  EXPECT_LE(reinterpret_cast<std::byte *>(span.data() + span.size()), storage + sizeof(storage));
+}
+
+//
+// pmr containers
+//
+TEST(PmrContainers, SteadyStateDoesNotTouchUpstream)
+{
+  counting_resource upstream;
+  arena scratch(1 << 16, &upstream);
+  ASSERT_EQ(upstream.allocations, 1u);
+
+  for (int iteration = 0; iteration < 100; ++iteration)
+  {
+    arena::scope guard(scratch);
+    hypercomplex::pmr::array<complex<float>> buffer(256, &scratch);
+    hypercomplex::pmr::array<float> mag(256, &scratch), phase(256, &scratch);
+    hypercomplex::pmr::matrix<complex<float>> mat(16, 16, &scratch);
+    buffer[1] = complex<float>(3.0f, 4.0f);
+    hypercomplex::to_polar<float>(buffer, mag, phase);
+    EXPECT_FLOAT_EQ(mag[1], 5.0f);
+  }
+  EXPECT_EQ(upstream.allocations, 1u);
+}
+
+TEST(PmrContainers, AllocatorIsPropagatedToCopies)
+{
+  arena scratch(4096);
+  hypercomplex::pmr::array<double> dut({1.0, 2.0, 3.0}, &scratch);
+  hypercomplex::pmr::array<double> copy(dut, &scratch);
+
+  EXPECT_EQ(copy.get_allocator().resource(), &scratch);
+  EXPECT_DOUBLE_EQ(copy[2], 3.0);
+}
+
+//
+// matrix
+//
+TEST(Matrix, RowMajorIndexing)
+{
+  hypercomplex::matrix<complex<double>> dut(2, 3);
+  dut(1, 2) = complex<double>(5.0, -1.0);
+
+  EXPECT_EQ(dut.rows(), 2u);
+  EXPECT_EQ(dut.cols(), 3u);
+  EXPECT_DOUBLE_EQ(dut.data()[1 * 3 + 2].real(), 5.0);
+  EXPECT_DOUBLE_EQ(dut.row(1)[2].imag(), -1.0);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : memory_tests.cpp
+// footer-end --------------------------------------------
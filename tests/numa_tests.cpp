@@ -0,0 +1,149 @@
+// header-begin ------------------------------------------
+// File       : numa_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/array.hpp"
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/complex.hpp"
+#include "hypercomplex/execution.hpp"
+#include "hypercomplex/memory.hpp"
+#include "hypercomplex/numa.hpp"
+
+#include <atomic>
+#include <span>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::numa_topology;
+using hypercomplex::thread_placement;
+using hypercomplex::thread_pool;
+namespace execution = hypercomplex::execution;
+
+//
+// numa_topology
+//
+TEST(NumaTopology, HasAtLeastOneNode)
+{
+  const numa_topology &topology = numa_topology::system();
+  ASSERT_GE(topology.nodes(), 1u);
+  EXPECT_EQ(&topology, &numa_topology::system());
+  EXPECT_GT(numa_topology::page_size(), 0u);
+
+  std::size_t cpus = 0;
+  for (std::size_t i = 0; i < topology.nodes(); ++i)
+    cpus += topology.cpus(i).size();
+#if defined(__linux__)
+  EXPECT_GT(cpus, 0u);
+#endif
+}
+
+//
+// thread_placement::numa
+//
+TEST(NumaPool, BlockedPartitionCoversRange)
+{
+  thread_pool pool(4, thread_placement::numa);
+  EXPECT_EQ(pool.placement(), thread_placement::numa);
+  EXPECT_EQ(pool.node_of(0), 0u);
+  for (std::size_t q = 1; q < pool.size(); ++q)
+  {
+    EXPECT_GE(pool.node_of(q), pool.node_of(q - 1));
+    EXPECT_LT(pool.node_of(q), numa_topology::system().nodes());
+  }
+
+  std::vector<std::atomic<int>> hits(100000);
+  pool.parallel_for(0, hits.size(), [&](std::size_t b, std::size_t e) {
+    for (std::size_t i = b; i < e; ++i)
+      hits[i].fetch_add(1);
+  }, 1000);
+  for (const auto &h : hits)
+    ASSERT_EQ(h.load(), 1);
+}
+
+TEST(NumaPool, NestedCallsFromWorkersCoverRange)
+{
+  // Nested ranges use the same blocked layout as outside calls, and
+  // the workers running them may steal across nodes
+  thread_pool pool(4, thread_placement::numa);
+  std::vector<std::atomic<int>> hits(64 * 4096);
+  pool.parallel_for(0, 64, [&](std::size_t b, std::size_t e) {
+    for (std::size_t r = b; r < e; ++r)
+      pool.parallel_for(r * 4096, (r + 1) * 4096, [&](std::size_t ib, std::size_t ie) {
+        for (std::size_t i = ib; i < ie; ++i)
+          hits[i].fetch_add(1);
+      }, 256);
+  }, 1);
+  for (const auto &h : hits)
+    ASSERT_EQ(h.load(), 1);
+}
+
+TEST(NumaPool, MatchesUnpinnedResults)
+{
+  thread_pool pinned(3, thread_placement::numa), unpinned(3);
+  const std::size_t n = 50000;
+  std::vector<complex<double>> a(n), b(n), r1(n), r2(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    a[i] = complex<double>(0.5 * i, 1.0 - i);
+    b[i] = complex<double>(2.0, 0.25 * i);
+  }
+  hypercomplex::multiply(execution::par.on(pinned), std::span<const complex<double>>(a),
+                         std::span<const complex<double>>(b), std::span(r1));
+  hypercomplex::multiply(execution::par.on(unpinned), std::span<const complex<double>>(a),
+                         std::span<const complex<double>>(b), std::span(r2));
+  EXPECT_EQ(r1, r2);
+}
+
+//
+// first_touch_allocator and the numa containers
+//
+TEST(NumaArray, LargeBuffersKeepTheirValues)
+{
+  thread_pool pool(4, thread_placement::numa);
+  hypercomplex::first_touch_allocator<complex<double>> alloc(pool);
+  EXPECT_EQ(&alloc.pool(), &pool);
+  EXPECT_FALSE(alloc == hypercomplex::first_touch_allocator<complex<double>>());
+
+  // 4 MiB, above the first touch threshold, and zero initialized as
+  // usual after the pages were touched
+  const std::size_t n = (std::size_t(4) << 20) / sizeof(complex<double>);
+  hypercomplex::numa::array<complex<double>> x(n, alloc);
+  ASSERT_EQ(x.size(), n);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(x.data()) % 64, 0u);
+  for (std::size_t i = 0; i < n; ++i)
+    ASSERT_EQ(x[i], complex<double>());
+
+  hypercomplex::numa::array<complex<double>> y(n, complex<double>(1.0, -1.0), alloc);
+  hypercomplex::add(execution::par.on(pool), std::span<const complex<double>>(y), std::span<const complex<double>>(y),
+                    std::span(x));
+  for (std::size_t i = 0; i < n; ++i)
+    ASSERT_EQ(x[i], complex<double>(2.0, -2.0));
+
+  hypercomplex::numa::matrix<float> m(1024, 512, 3.0f, hypercomplex::first_touch_allocator<float>(pool));
+  EXPECT_EQ(m.rows(), 1024u);
+  EXPECT_EQ(m(1023, 511), 3.0f);
+
+  // small blocks and the default pool take the plain aligned path
+  hypercomplex::numa::array<double> small(16, 1.5);
+  EXPECT_EQ(small[15], 1.5);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : numa_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,178 @@
+// header-begin ------------------------------------------
+// File       : orientation_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/orientation.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using hypercomplex::accuracy;
+using hypercomplex::orientation_integrator;
+using hypercomplex::quaternion;
+using hypercomplex::quaternion_soa;
+using hypercomplex::vector3_soa;
+
+namespace
+{
+// Bodies with assorted unit orientations and angular velocities
+template <typename T> struct bodies
+{
+  std::vector<T> w, x, y, z, ox, oy, oz;
+
+  explicit bodies(std::size_t n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const double a = 0.1 * static_cast<double>(i);
+      const quaternion<double> q
+          = hypercomplex::normalize(quaternion<double>(std::cos(a), std::sin(1.3 * a), 0.5 - std::cos(0.7 * a), 0.25));
+      w.push_back(static_cast<T>(q.w()));
+      x.push_back(static_cast<T>(q.x()));
+      y.push_back(static_cast<T>(q.y()));
+      z.push_back(static_cast<T>(q.z()));
+      ox.push_back(static_cast<T>(3.0 * std::sin(0.9 * a)));
+      oy.push_back(static_cast<T>(-2.0 + std::cos(0.4 * a)));
+      oz.push_back(static_cast<T>(static_cast<double>(i % 5) - 2.0));
+    }
+  }
+  quaternion_soa<T>
+  q()
+  {
+    return {w, x, y, z};
+  }
+  vector3_soa<T>
+  omega() const
+  {
+    return {ox, oy, oz};
+  }
+};
+
+// Exact solution for a constant world frame omega
+quaternion<double>
+rotated(const quaternion<double> &q, double ox, double oy, double oz, double t)
+{
+  return exp(quaternion<double>(0, 0.5 * t * ox, 0.5 * t * oy, 0.5 * t * oz)) * q;
+}
+
+double
+distance(const quaternion<double> &a, const quaternion<double> &b)
+{
+  return abs(a - b);
+}
+} // namespace
+
+TEST(Orientation, RsqrtReachesWorkingPrecision)
+{
+  for (double n = 1e-6; n < 1e6; n *= 1.37)
+  {
+    const double f = hypercomplex::__detail::__rsqrt(static_cast<float>(n));
+    EXPECT_NEAR(f * std::sqrt(static_cast<float>(n)), 1.0, 4 * std::numeric_limits<float>::epsilon()) << n;
+    const double d = hypercomplex::__detail::__rsqrt(n);
+    EXPECT_NEAR(d * std::sqrt(n), 1.0, 4 * std::numeric_limits<double>::epsilon()) << n;
+  }
+}
+
+TEST(Orientation, IntegratorsConvergeToExactRotation)
+{
+  const std::size_t n = 37, steps = 200;
+  const double dt = 1e-3;
+  const bodies<double> start(n);
+  const double tolerance[] = {1e-3, 1e-13, 1e-12};
+  const orientation_integrator methods[]
+      = {orientation_integrator::first_order, orientation_integrator::exponential_map, orientation_integrator::rk4};
+  for (std::size_t m = 0; m < 3; ++m)
+  {
+    bodies<double> b = start;
+    for (std::size_t s = 0; s < steps; ++s)
+      hypercomplex::integrate_orientations<double>(b.q(), b.omega(), dt, methods[m]);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+      const quaternion<double> q0(start.w[i], start.x[i], start.y[i], start.z[i]);
+      const auto exact = rotated(q0, b.ox[i], b.oy[i], b.oz[i], dt * steps);
+      EXPECT_LT(distance(b.q()[i], exact), tolerance[m]) << m << " " << i;
+      EXPECT_NEAR(norm(b.q()[i]), 1.0, 1e-15) << m << " " << i;
+    }
+  }
+}
+
+TEST(Orientation, FirstOrderErrorShrinksWithStep)
+{
+  const bodies<double> start(16);
+  double error[2];
+  for (int k = 0; k < 2; ++k)
+  {
+    bodies<double> b = start;
+    const double dt = k == 0 ? 1e-2 : 5e-3;
+    const int steps = k == 0 ? 50 : 100;
+    for (int s = 0; s < steps; ++s)
+      hypercomplex::integrate_orientations<double>(b.q(), b.omega(), dt, orientation_integrator::first_order);
+    error[k] = 0;
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+      const quaternion<double> q0(start.w[i], start.x[i], start.y[i], start.z[i]);
+      error[k] = std::max(error[k], distance(b.q()[i], rotated(q0, b.ox[i], b.oy[i], b.oz[i], 0.5)));
+    }
+  }
+  EXPECT_LT(error[1], 0.6 * error[0]);
+}
+
+TEST(Orientation, FloatBatchStaysUnitAndAccurate)
+{
+  bodies<float> b(1001);
+  const bodies<float> start = b;
+  for (int s = 0; s < 100; ++s)
+    hypercomplex::integrate_orientations<float>(b.q(), b.omega(), 1e-2f, orientation_integrator::exponential_map,
+                                                accuracy::balanced);
+  for (std::size_t i = 0; i < b.w.size(); ++i)
+  {
+    const quaternion<double> q(b.w[i], b.x[i], b.y[i], b.z[i]);
+    const quaternion<double> q0(start.w[i], start.x[i], start.y[i], start.z[i]);
+    EXPECT_NEAR(norm(q), 1.0, 1e-6) << i;
+    EXPECT_LT(distance(q, rotated(q0, b.ox[i], b.oy[i], b.oz[i], 1.0)), 2e-5) << i;
+  }
+}
+
+TEST(Orientation, NormalizeAndParallelMatchSequential)
+{
+  bodies<double> seq(20000), par = seq;
+  for (std::size_t i = 0; i < seq.w.size(); ++i)
+  {
+    seq.w[i] *= 1.5;
+    par.w[i] *= 1.5;
+  }
+  hypercomplex::normalize(seq.q());
+  hypercomplex::normalize(hypercomplex::execution::par, par.q());
+  for (std::size_t i = 0; i < seq.w.size(); ++i)
+    ASSERT_NEAR(norm(seq.q()[i]), 1.0, 1e-15) << i;
+
+  hypercomplex::integrate_orientations<double>(seq.q(), seq.omega(), 1e-2, orientation_integrator::rk4);
+  hypercomplex::integrate_orientations(hypercomplex::execution::par, par.q(), par.omega(), 1e-2,
+                                       orientation_integrator::rk4);
+  EXPECT_EQ(seq.w, par.w);
+  EXPECT_EQ(seq.x, par.x);
+  EXPECT_EQ(seq.y, par.y);
+  EXPECT_EQ(seq.z, par.z);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : orientation_tests.cpp
+// footer-end --------------------------------------------
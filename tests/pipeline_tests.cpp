@@ -0,0 +1,140 @@
+// header-begin ------------------------------------------
+// File       : pipeline_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/fir.hpp"
+#include "hypercomplex/pipeline.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::pipeline;
+
+namespace
+{
+std::vector<complex<float>>
+ramp(std::size_t n)
+{
+  std::vector<complex<float>> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+    v[i] = complex<float>(static_cast<float>(i % 101) - 50.0f, static_cast<float>(i % 7));
+  return v;
+}
+} // namespace
+
+TEST(Pipeline, StagesMatchSequentialProcessing)
+{
+  const auto x = ramp(50000);
+  const std::vector<complex<float>> taps{{0.5f, 0.0f}, {0.25f, 0.25f}, {0.0f, -0.5f}};
+
+  // Reference: mix, filter, decimate by 2 over the whole buffer
+  std::vector<complex<float>> mixed(x.size()), ref(x.size());
+  for (std::size_t i = 0; i < x.size(); ++i)
+    mixed[i] = x[i] * complex<float>(0.0f, 1.0f);
+  hypercomplex::fir_filter<float> ref_fir(taps);
+  ref_fir.process(mixed, ref);
+  std::vector<complex<float>> expected;
+  for (std::size_t i = 0; i < ref.size(); i += 2)
+    expected.push_back(ref[i]);
+
+  hypercomplex::fir_filter<float> fir(taps);
+  std::vector<complex<float>> got;
+  pipeline<float> p(1000);
+  p.add_stage(
+       [](std::span<const complex<float>> in, std::span<complex<float>> out)
+       {
+         for (std::size_t i = 0; i < in.size(); ++i)
+           out[i] = in[i] * complex<float>(0.0f, 1.0f);
+       })
+      .add_stage([&](std::span<const complex<float>> in, std::span<complex<float>> out) { fir.process(in, out); })
+      .add_stage(
+          [](std::span<const complex<float>> in, std::span<complex<float>> out)
+          {
+            // Blocks have an even length, so decimation stays in phase
+            std::size_t n = 0;
+            for (std::size_t i = 0; i < in.size(); i += 2)
+              out[n++] = in[i];
+            return n;
+          })
+      .set_sink([&](std::span<const complex<float>> out) { got.insert(got.end(), out.begin(), out.end()); });
+
+  for (std::size_t i = 0; i < x.size(); i += 4000)
+    p.push(std::span(x).subspan(i, std::min<std::size_t>(4000, x.size() - i)));
+  p.finish();
+
+  ASSERT_EQ(got.size(), expected.size());
+  for (std::size_t i = 0; i < got.size(); ++i)
+    ASSERT_EQ(got[i], expected[i]) << i;
+}
+
+TEST(Pipeline, BackpressureBoundsBlocksInFlight)
+{
+  const std::size_t stages = 3;
+  std::atomic<int> in_flight{0}, max_in_flight{0};
+  pipeline<double> p(16);
+  for (std::size_t s = 0; s < stages; ++s)
+    p.add_stage([](std::span<const complex<double>> in, std::span<complex<double>> out)
+                { std::copy(in.begin(), in.end(), out.begin()); });
+  p.set_sink(
+      [&](std::span<const complex<double>>)
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        --in_flight;
+      });
+
+  const std::vector<complex<double>> block(16);
+  for (int i = 0; i < 200; ++i)
+  {
+    p.push(block);
+    const int now = ++in_flight;
+    int seen = max_in_flight.load();
+    while (now > seen && !max_in_flight.compare_exchange_weak(seen, now))
+    {
+    }
+  }
+  p.finish();
+
+  // Two buffered blocks per stage plus one being processed by each
+  // stage and one in the sink
+  EXPECT_LE(max_in_flight.load(), static_cast<int>(3 * stages + 1));
+  EXPECT_EQ(in_flight.load(), 0);
+}
+
+TEST(Pipeline, StageExceptionsReachTheCaller)
+{
+  pipeline<float> p(8);
+  p.add_stage([](std::span<const complex<float>>, std::span<complex<float>>) -> std::size_t
+              { throw std::runtime_error("stage failed"); });
+  const std::vector<complex<float>> block(8);
+  EXPECT_THROW(
+      {
+        for (int i = 0; i < 100; ++i)
+          p.push(block);
+        p.finish();
+      },
+      std::runtime_error);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : pipeline_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,209 @@
+// header-begin ------------------------------------------
+// File       : qr_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/qr.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::matrix;
+using hypercomplex::qr_decomposition;
+using hypercomplex::qr_method;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+matrix<complex<double>>
+random_matrix(std::size_t m, std::size_t n, unsigned seed)
+{
+  std::mt19937_64 rng(seed);
+  std::normal_distribution<double> g;
+  matrix<complex<double>> a(m, n);
+  for (auto &z : a)
+    z = complex<double>(g(rng), g(rng));
+  return a;
+}
+
+double
+magnitude(const complex<double> &z)
+{
+  return std::hypot(z.real(), z.imag());
+}
+
+// A^H (A x - b), zero at the least-squares solution
+std::vector<complex<double>>
+normal_residual(const matrix<complex<double>> &a, std::span<const complex<double>> x, std::span<const complex<double>> b)
+{
+  std::vector<complex<double>> r(a.rows()), g(a.cols());
+  for (std::size_t i = 0; i < a.rows(); ++i)
+  {
+    r[i] = -b[i];
+    for (std::size_t j = 0; j < a.cols(); ++j)
+      r[i] += a(i, j) * x[j];
+  }
+  for (std::size_t i = 0; i < a.rows(); ++i)
+    for (std::size_t j = 0; j < a.cols(); ++j)
+      g[j] += conj(a(i, j)) * r[i];
+  return g;
+}
+} // namespace
+
+TEST(QR, LeastSquaresSatisfiesNormalEquations)
+{
+  for (qr_method method : {qr_method::householder, qr_method::tsqr})
+  {
+    const std::size_t m = 5000, n = 40;
+    const auto a = random_matrix(m, n, 1);
+    const auto bm = random_matrix(m, 1, 2);
+    const std::vector<complex<double>> b(bm.begin(), bm.end());
+
+    const qr_decomposition<double> qr(a, method);
+    EXPECT_EQ(qr.leaves(), method == qr_method::tsqr ? m / 1024 : 1u);
+    std::vector<complex<double>> x(n);
+    qr.solve(b, std::span(x));
+    for (const auto &z : normal_residual(a, x, b))
+      ASSERT_LT(magnitude(z), 1e-8);
+  }
+}
+
+TEST(QR, ConsistentSystemIsSolvedExactly)
+{
+  // Square and spans several panels; b = A x0 so the residual is zero
+  const std::size_t n = 100;
+  const auto a = random_matrix(n, n, 3);
+  std::vector<complex<double>> x0(n), b(n);
+  for (std::size_t i = 0; i < n; ++i)
+    x0[i] = complex<double>(static_cast<double>(i) / n, 1.0 - static_cast<double>(i % 3));
+  for (std::size_t i = 0; i < n; ++i)
+    for (std::size_t j = 0; j < n; ++j)
+      b[i] += a(i, j) * x0[j];
+
+  const qr_decomposition<double> qr(a);
+  std::vector<complex<double>> x(n);
+  qr.solve(b, std::span(x));
+  for (std::size_t i = 0; i < n; ++i)
+    ASSERT_LT(magnitude(x[i] - x0[i]), 1e-10);
+
+  // R^H R = A^H A
+  const auto r = qr.r();
+  for (std::size_t i = 0; i < n; i += 17)
+    for (std::size_t j = 0; j < n; j += 13)
+    {
+      complex<double> rr, aa;
+      for (std::size_t p = 0; p < n; ++p)
+      {
+        rr += conj(r(p, i)) * r(p, j);
+        aa += conj(a(p, i)) * a(p, j);
+      }
+      ASSERT_LT(magnitude(rr - aa), 1e-9);
+    }
+}
+
+TEST(QR, TsqrParallelAndSolveMany)
+{
+  const std::size_t m = 9000, n = 16, k = 3;
+  const auto a = random_matrix(m, n, 4);
+  const auto b = random_matrix(m, k, 5);
+  hypercomplex::thread_pool pool(3);
+  const qr_decomposition<double> seq(a);
+  const qr_decomposition<double> par(execution::par.on(pool), a);
+  EXPECT_GT(seq.leaves(), 1u);
+  const auto rs = seq.r(), rp = par.r();
+  EXPECT_TRUE(std::equal(rs.begin(), rs.end(), rp.begin()));
+
+  const auto x = par.solve_many(execution::par.on(pool), b);
+  ASSERT_EQ(x.rows(), n);
+  ASSERT_EQ(x.cols(), k);
+  for (std::size_t c = 0; c < k; ++c)
+  {
+    std::vector<complex<double>> bc(m), xc(n), expected(n);
+    for (std::size_t i = 0; i < m; ++i)
+      bc[i] = b(i, c);
+    for (std::size_t i = 0; i < n; ++i)
+      xc[i] = x(i, c);
+    seq.solve(bc, std::span(expected));
+    for (std::size_t i = 0; i < n; ++i)
+      ASSERT_LT(magnitude(expected[i] - xc[i]), 1e-12);
+    for (const auto &z : normal_residual(a, xc, bc))
+      ASSERT_LT(magnitude(z), 1e-8);
+  }
+}
+
+TEST(QR, SolvesFromArenaScratch)
+{
+  for (qr_method method : {qr_method::householder, qr_method::tsqr})
+  {
+    const std::size_t m = 4096, n = 24, k = 2;
+    const auto a = random_matrix(m, n, 7);
+    const auto b = random_matrix(m, k, 8);
+    const qr_decomposition<double> qr(a, method);
+    const auto expected = qr.solve_many(b);
+
+    // Every solve fits in scratch_size() and leaves the arena as it was
+    hypercomplex::arena scratch(qr.scratch_size(k));
+    for (int repeat = 0; repeat < 3; ++repeat)
+    {
+      hypercomplex::arena::scope guard(scratch);
+      const auto x = qr.solve_many(b, &scratch);
+      EXPECT_TRUE(std::equal(x.begin(), x.end(), expected.begin()));
+    }
+    EXPECT_EQ(scratch.used(), 0u);
+    EXPECT_LE(scratch.high_water(), qr.scratch_size(k));
+
+    std::vector<complex<double>> b0(m), x0(n), x1(n);
+    for (std::size_t i = 0; i < m; ++i)
+      b0[i] = b(i, 0);
+    qr.solve(b0, std::span(x0));
+    {
+      hypercomplex::arena::scope guard(scratch);
+      qr.solve(b0, std::span(x1), &scratch);
+    }
+    EXPECT_EQ(x0, x1);
+  }
+}
+
+TEST(QR, RejectsBadInput)
+{
+  EXPECT_THROW(qr_decomposition<double>(matrix<complex<double>>(3, 4)), std::invalid_argument);
+
+  // The second column is zero, so R has a zero on its diagonal
+  matrix<complex<double>> a(4, 2);
+  for (std::size_t i = 0; i < 4; ++i)
+    a(i, 0) = complex<double>(1.0 + i, 0.5 * i);
+  const qr_decomposition<double> qr(a);
+  EXPECT_TRUE(qr.rank_deficient());
+  std::vector<complex<double>> b(4), x(2);
+  EXPECT_THROW(qr.solve(b, std::span(x)), std::invalid_argument);
+
+  const qr_decomposition<double> ok(random_matrix(4, 2, 6));
+  EXPECT_FALSE(ok.rank_deficient());
+  std::vector<complex<double>> wrong(5);
+  EXPECT_THROW(ok.solve(wrong, std::span(x)), std::invalid_argument);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : qr_tests.cpp
+// footer-end --------------------------------------------
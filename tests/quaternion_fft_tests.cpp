@@ -0,0 +1,220 @@
+// header-begin ------------------------------------------
+// File       : quaternion_fft_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/quaternion_fft.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+
+// Every heap allocation of the test binary is counted, to check that
+// transforming with an existing plan does not allocate
+namespace
+{
+std::atomic<std::size_t> heap_allocations{0};
+
+void *
+counted_alloc(std::size_t n, std::size_t align)
+{
+  heap_allocations.fetch_add(1, std::memory_order_relaxed);
+  n = (std::max<std::size_t>(n, 1) + align - 1) / align * align;
+  if (void *p = std::aligned_alloc(align, n))
+    return p;
+  throw std::bad_alloc();
+}
+} // namespace
+
+void *
+operator new(std::size_t n)
+{
+  return counted_alloc(n, alignof(std::max_align_t));
+}
+void *
+operator new(std::size_t n, std::align_val_t a)
+{
+  return counted_alloc(n, static_cast<std::size_t>(a));
+}
+void
+operator delete(void *p) noexcept
+{
+  std::free(p);
+}
+void
+operator delete(void *p, std::size_t) noexcept
+{
+  std::free(p);
+}
+void
+operator delete(void *p, std::align_val_t) noexcept
+{
+  std::free(p);
+}
+void
+operator delete(void *p, std::size_t, std::align_val_t) noexcept
+{
+  std::free(p);
+}
+
+using hypercomplex::matrix;
+using hypercomplex::qft_side;
+using hypercomplex::quaternion;
+using hypercomplex::quaternion_fft_plan;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+matrix<quaternion<double>>
+random_field(std::size_t m, std::size_t n, unsigned seed)
+{
+  std::mt19937_64 rng(seed);
+  std::uniform_real_distribution<double> u(-1.0, 1.0);
+  matrix<quaternion<double>> f(m, n);
+  for (auto &q : f)
+    q = quaternion<double>(u(rng), u(rng), u(rng), u(rng));
+  return f;
+}
+
+// exp(mu t) for a unit pure mu
+quaternion<double>
+kernel(const quaternion<double> &mu, double t)
+{
+  return quaternion<double>(std::cos(t)) + mu * std::sin(t);
+}
+
+// The defining sums, O(M^2 N^2)
+matrix<quaternion<double>>
+direct(const matrix<quaternion<double>> &f, const quaternion<double> &mu, qft_side side)
+{
+  const std::size_t m = f.rows(), n = f.cols();
+  matrix<quaternion<double>> out(m, n);
+  for (std::size_t u = 0; u < m; ++u)
+    for (std::size_t v = 0; v < n; ++v)
+    {
+      quaternion<double> s;
+      for (std::size_t r = 0; r < m; ++r)
+        for (std::size_t c = 0; c < n; ++c)
+        {
+          const double a = -2 * std::numbers::pi * static_cast<double>(r * u) / m;
+          const double b = -2 * std::numbers::pi * static_cast<double>(c * v) / n;
+          switch (side)
+          {
+          case qft_side::left:
+            s += kernel(mu, a + b) * f(r, c);
+            break;
+          case qft_side::right:
+            s += f(r, c) * kernel(mu, a + b);
+            break;
+          case qft_side::both:
+            s += kernel(mu, a) * f(r, c) * kernel(mu, b);
+            break;
+          }
+        }
+      out(u, v) = s;
+    }
+  return out;
+}
+
+double
+distance(const matrix<quaternion<double>> &a, const matrix<quaternion<double>> &b)
+{
+  double worst = 0;
+  for (std::size_t i = 0; i < a.rows(); ++i)
+    for (std::size_t j = 0; j < a.cols(); ++j)
+      worst = std::max(worst, abs(a(i, j) - b(i, j)));
+  return worst;
+}
+} // namespace
+
+TEST(QuaternionFFT, MatchesDirectSums)
+{
+  const auto f = random_field(8, 16, 1);
+  for (const quaternion<double> &axis : {quaternion<double>(0, 1, 1, 1), quaternion<double>(0, 1, 0, 0),
+                                         quaternion<double>(0, 0.3, -2.0, 0.5)})
+  {
+    quaternion_fft_plan<double> plan(8, 16, axis);
+    EXPECT_NEAR(abs(plan.axis()), 1.0, 1e-15);
+    for (qft_side side : {qft_side::left, qft_side::right, qft_side::both})
+    {
+      auto g = f;
+      plan.forward(g, side);
+      EXPECT_LT(distance(g, direct(f, plan.axis(), side)), 1e-11);
+    }
+  }
+}
+
+TEST(QuaternionFFT, InverseRoundTrip)
+{
+  const auto f = random_field(32, 8, 2);
+  quaternion_fft_plan<double> plan(32, 8);
+  for (qft_side side : {qft_side::left, qft_side::right, qft_side::both})
+  {
+    auto g = f;
+    plan.forward(g, side);
+    plan.inverse(g, side);
+    for (auto &q : g)
+      q = q / 256.0;
+    EXPECT_LT(distance(g, f), 1e-13);
+  }
+}
+
+TEST(QuaternionFFT, ParallelMatchesSequential)
+{
+  const auto f = random_field(64, 128, 3);
+  quaternion_fft_plan<double> plan(64, 128);
+  hypercomplex::thread_pool pool(3);
+  for (qft_side side : {qft_side::left, qft_side::both})
+  {
+    auto s = f, p = f;
+    plan.forward(s, side);
+    plan.forward(execution::par.on(pool), p, side);
+    EXPECT_EQ(distance(s, p), 0.0);
+  }
+}
+
+TEST(QuaternionFFT, SteadyStateDoesNotAllocate)
+{
+  auto f = random_field(32, 64, 4);
+  quaternion_fft_plan<double> plan(32, 64);
+  plan.forward(f, qft_side::both);
+
+  const std::size_t before = heap_allocations.load();
+  for (int frame = 0; frame < 4; ++frame)
+  {
+    plan.forward(f, qft_side::left);
+    plan.inverse(f, qft_side::both);
+  }
+  EXPECT_EQ(heap_allocations.load(), before);
+}
+
+TEST(QuaternionFFT, RejectsBadPlans)
+{
+  EXPECT_THROW(quaternion_fft_plan<double>(12, 16), std::invalid_argument);
+  EXPECT_THROW(quaternion_fft_plan<double>(16, 16, quaternion<double>(1, 0, 0, 0)), std::invalid_argument);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : quaternion_fft_tests.cpp
+// footer-end --------------------------------------------
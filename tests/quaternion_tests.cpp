@@ -0,0 +1,85 @@
+// header-begin ------------------------------------------
+// File       : quaternion_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/quaternion.hpp"
+
+#include <cmath>
+
+using hypercomplex::quaternion;
+
+namespace
+{
+void
+expect_near(const quaternion<double> &a, const quaternion<double> &b, double tol)
+{
+  EXPECT_NEAR(a.w(), b.w(), tol);
+  EXPECT_NEAR(a.x(), b.x(), tol);
+  EXPECT_NEAR(a.y(), b.y(), tol);
+  EXPECT_NEAR(a.z(), b.z(), tol);
+}
+} // namespace
+
+TEST(Quaternion, HamiltonProductOfBasisElements)
+{
+  const quaternion<double> one(1, 0, 0, 0), i(0, 1, 0, 0), j(0, 0, 1, 0), k(0, 0, 0, 1);
+  EXPECT_EQ(i * i, -one);
+  EXPECT_EQ(j * j, -one);
+  EXPECT_EQ(k * k, -one);
+  EXPECT_EQ(i * j, k);
+  EXPECT_EQ(j * k, i);
+  EXPECT_EQ(k * i, j);
+  EXPECT_EQ(j * i, -k);
+  EXPECT_EQ(i * j * k, -one);
+}
+
+TEST(Quaternion, ConjugateInverseAndNorm)
+{
+  const quaternion<double> q(1.5, -2.0, 0.25, 3.0);
+  EXPECT_DOUBLE_EQ(norm(q), 1.5 * 1.5 + 4.0 + 0.0625 + 9.0);
+  EXPECT_DOUBLE_EQ(abs(q) * abs(q), norm(q));
+  expect_near(q * inverse(q), quaternion<double>(1.0), 1e-15);
+  expect_near(inverse(q) * q, quaternion<double>(1.0), 1e-15);
+  EXPECT_EQ(conj(conj(q)), q);
+  EXPECT_NEAR(abs(normalize(q)), 1.0, 1e-15);
+}
+
+TEST(Quaternion, ExpOfHalfAngleIsRotation)
+{
+  // exp(theta/2 * k) rotates the x axis by theta about z
+  const double theta = 0.8;
+  const auto r = exp(quaternion<double>(0, 0, 0, theta / 2));
+  expect_near(r, quaternion<double>(std::cos(theta / 2), 0, 0, std::sin(theta / 2)), 1e-15);
+  const auto v = r * quaternion<double>(0, 1, 0, 0) * conj(r);
+  expect_near(v, quaternion<double>(0, std::cos(theta), std::sin(theta), 0), 1e-15);
+
+  EXPECT_EQ(exp(quaternion<double>(0.5)), quaternion<double>(std::exp(0.5)));
+}
+
+TEST(Quaternion, LogInvertsExp)
+{
+  const quaternion<double> q(0.3, -0.7, 0.2, 1.1);
+  expect_near(exp(log(q)), q, 1e-14);
+  expect_near(log(exp(q)), q, 1e-14);
+  expect_near(log(quaternion<double>(2.0)), quaternion<double>(std::log(2.0)), 0.0);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : quaternion_tests.cpp
+// footer-end --------------------------------------------
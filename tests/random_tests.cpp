@@ -0,0 +1,124 @@
+// header-begin ------------------------------------------
+// File       : random_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/random.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <vector>
+
+using hypercomplex::accuracy;
+using hypercomplex::complex;
+using hypercomplex::philox_stream;
+namespace execution = hypercomplex::execution;
+
+// Known answers from the Random123 distribution (kat_vectors)
+TEST(Random, PhiloxKnownAnswers)
+{
+  using block = std::array<std::uint32_t, 4>;
+  EXPECT_EQ(hypercomplex::__detail::__philox({0, 0, 0, 0}, {0, 0}),
+            (block{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}));
+  EXPECT_EQ(hypercomplex::__detail::__philox({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}),
+            (block{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}));
+  EXPECT_EQ(hypercomplex::__detail::__philox({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}),
+            (block{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}));
+}
+
+TEST(Random, ReproducibleAcrossThreadsAndCalls)
+{
+  std::vector<complex<double>> whole(100000);
+  philox_stream s(42, 7);
+  hypercomplex::gaussian_noise(s, std::span(whole), 2.0, accuracy::balanced);
+  EXPECT_EQ(s.position(), whole.size());
+
+  // Same samples from two calls, and from a parallel fill
+  std::vector<complex<double>> parts(whole.size());
+  philox_stream t(42, 7);
+  hypercomplex::gaussian_noise(t, std::span(parts).first(12345), 2.0, accuracy::balanced);
+  hypercomplex::thread_pool pool(3);
+  hypercomplex::gaussian_noise(execution::par.on(pool), t, std::span(parts).subspan(12345), 2.0, accuracy::balanced);
+  EXPECT_EQ(parts, whole);
+
+  // Another stream or a split child gives different samples
+  std::vector<complex<double>> other(16), child(16);
+  philox_stream o(42, 8);
+  hypercomplex::gaussian_noise(o, std::span(other), 2.0, accuracy::balanced);
+  philox_stream c = philox_stream(42, 7).split(0);
+  hypercomplex::gaussian_noise(c, std::span(child), 2.0, accuracy::balanced);
+  EXPECT_NE(other[0], whole[0]);
+  EXPECT_NE(child[0], whole[0]);
+  EXPECT_NE(philox_stream(1).split(0).stream(), philox_stream(1).split(1).stream());
+}
+
+TEST(Random, GaussianMoments)
+{
+  for (accuracy a : {accuracy::fast, accuracy::balanced, accuracy::precise})
+  {
+    std::vector<complex<float>> v(1 << 20);
+    philox_stream s(2026);
+    const float sigma = 3.0f;
+    hypercomplex::gaussian_noise(s, std::span(v), sigma, a);
+    double mr = 0, mi = 0, rr = 0, ii = 0, ri = 0, r4 = 0;
+    for (const auto &z : v)
+    {
+      mr += z.real();
+      mi += z.imag();
+      rr += z.real() * z.real();
+      ii += z.imag() * z.imag();
+      ri += z.real() * z.imag();
+      r4 += static_cast<double>(z.real()) * z.real() * z.real() * z.real();
+    }
+    const double n = static_cast<double>(v.size());
+    const double half = sigma * sigma / 2.0;
+    // Tolerances are about five standard errors
+    EXPECT_NEAR(mr / n, 0.0, 0.01);
+    EXPECT_NEAR(mi / n, 0.0, 0.01);
+    EXPECT_NEAR(rr / n, half, 0.03);
+    EXPECT_NEAR(ii / n, half, 0.03);
+    EXPECT_NEAR(ri / n, 0.0, 0.02);
+    // Gaussian kurtosis: E x^4 = 3 var^2
+    EXPECT_NEAR(r4 / n, 3 * half * half, 1.0);
+  }
+}
+
+TEST(Random, UniformPhase)
+{
+  std::vector<complex<double>> v(1 << 18);
+  philox_stream s(5);
+  hypercomplex::uniform_phase(s, std::span(v), 0.5, accuracy::fast);
+  std::array<std::size_t, 8> octants{};
+  for (const auto &z : v)
+  {
+    ASSERT_NEAR(std::hypot(z.real(), z.imag()), 0.5, 1e-4);
+    const double t = std::atan2(z.imag(), z.real()) + std::numbers::pi;
+    ++octants[std::min<std::size_t>(7, static_cast<std::size_t>(t / (std::numbers::pi / 4)))];
+  }
+  for (std::size_t k : octants)
+    EXPECT_NEAR(static_cast<double>(k), v.size() / 8.0, 600.0);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : random_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,142 @@
+// header-begin ------------------------------------------
+// File       : reduce_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/reduce.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+using hypercomplex::complex;
+namespace execution = hypercomplex::execution;
+
+namespace
+{
+// Large values that cancel plus many small ones; a naive float sum
+// loses most of the small ones
+std::vector<complex<float>>
+ill_conditioned(std::size_t n)
+{
+  std::vector<complex<float>> v(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    const float small = 0.001f * static_cast<float>(i % 97) + 0.01f;
+    const float big = (i % 2 == 0 ? 1.0f : -1.0f) * 1e6f * static_cast<float>(1 + i % 5);
+    v[i] = complex<float>(i % 64 < 2 ? big : small, i % 64 == 5 ? -big : small - 0.05f);
+  }
+  return v;
+}
+
+long double
+exact_real_sum(const std::vector<complex<float>> &v)
+{
+  long double s = 0;
+  for (const auto &z : v)
+    s += z.real();
+  return s;
+}
+} // namespace
+
+TEST(Reduce, CompensatedSumBeatsNaiveSum)
+{
+  const auto v = ill_conditioned(1000003);
+  const long double exact = exact_real_sum(v);
+  float naive = 0;
+  for (const auto &z : v)
+    naive += z.real();
+
+  const complex<float> s = hypercomplex::sum<float>(v);
+  const long double err = std::abs(static_cast<long double>(s.real()) - exact);
+  EXPECT_LE(err, 2 * std::numeric_limits<float>::epsilon() * std::abs(exact));
+  EXPECT_LT(err, std::abs(static_cast<long double>(naive) - exact));
+}
+
+TEST(Reduce, BitIdenticalForAnyThreadCount)
+{
+  const auto v = ill_conditioned(300001);
+  const auto w = ill_conditioned(300001);
+  const complex<float> s = hypercomplex::sum<float>(v);
+  const complex<float> d = hypercomplex::dot<float>(v, w);
+  const float n = hypercomplex::norm2<float>(v);
+  const float var = hypercomplex::variance<float>(v);
+  for (std::size_t threads : {1u, 2u, 3u, 7u})
+  {
+    hypercomplex::thread_pool pool(threads);
+    const auto par = execution::par.on(pool);
+    EXPECT_EQ(hypercomplex::sum<float>(par, v), s) << threads;
+    EXPECT_EQ(hypercomplex::dot<float>(par, v, w), d) << threads;
+    EXPECT_EQ(hypercomplex::norm2<float>(par, v), n) << threads;
+    EXPECT_EQ(hypercomplex::variance<float>(execution::par_unseq.on(pool), v), var) << threads;
+  }
+}
+
+TEST(Reduce, DotNormAndVarianceMatchLongDouble)
+{
+  std::vector<complex<double>> a(50000), b(a.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    const double t = 0.001 * static_cast<double>(i);
+    a[i] = complex<double>(std::cos(t) + 3.0, std::sin(3 * t));
+    b[i] = complex<double>(std::sin(t), 2.0 - std::cos(5 * t));
+  }
+  long double dr = 0, di = 0, nn = 0, mr = 0, mi = 0;
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    const long double ar = a[i].real(), ai = a[i].imag(), br = b[i].real(), bi = b[i].imag();
+    dr += ar * br + ai * bi;
+    di += ar * bi - ai * br;
+    nn += ar * ar + ai * ai;
+    mr += ar;
+    mi += ai;
+  }
+  mr /= a.size();
+  mi /= a.size();
+  long double var = 0;
+  for (const auto &z : a)
+    var += (z.real() - mr) * (z.real() - mr) + (z.imag() - mi) * (z.imag() - mi);
+  var /= a.size();
+
+  const auto d = hypercomplex::dot<double>(a, b);
+  EXPECT_NEAR(d.real(), static_cast<double>(dr), 1e-15 * std::abs(dr));
+  EXPECT_NEAR(d.imag(), static_cast<double>(di), 1e-15 * std::abs(dr));
+  EXPECT_NEAR(hypercomplex::norm2<double>(a), static_cast<double>(std::sqrt(nn)), 1e-15 * std::sqrt(nn));
+  const auto m = hypercomplex::mean<double>(a);
+  EXPECT_NEAR(m.real(), static_cast<double>(mr), 1e-15);
+  EXPECT_NEAR(m.imag(), static_cast<double>(mi), 1e-15);
+  EXPECT_NEAR(hypercomplex::variance<double>(a), static_cast<double>(var), 1e-14 * var);
+}
+
+TEST(Reduce, EmptyAndShortInputs)
+{
+  const std::vector<complex<double>> none;
+  EXPECT_EQ(hypercomplex::sum<double>(none), complex<double>());
+  EXPECT_EQ(hypercomplex::norm2<double>(none), 0.0);
+  EXPECT_TRUE(std::isnan(hypercomplex::mean<double>(none).real()));
+
+  const std::vector<complex<double>> three{{1.0, 2.0}, {3.0, -4.0}, {5.0, 0.5}};
+  EXPECT_EQ(hypercomplex::sum<double>(three), complex<double>(9.0, -1.5));
+  // mean (3, -0.5); squared deviations 10.25, 12.25 and 5
+  EXPECT_DOUBLE_EQ(hypercomplex::variance<double>(three), 27.5 / 3);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : reduce_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,234 @@
+// header-begin ------------------------------------------
+// File       : resampler_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/resampler.hpp"
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::halfband_decimator;
+using hypercomplex::polyphase_resampler;
+
+namespace
+{
+std::vector<complex<double>>
+noise(std::size_t n, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::normal_distribution<double> d;
+  std::vector<complex<double>> v(n);
+  for (auto &z : v)
+    z = complex<double>(d(gen), d(gen));
+  return v;
+}
+
+std::vector<double>
+real_noise(std::size_t n, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::normal_distribution<double> d;
+  std::vector<double> v(n);
+  for (auto &x : v)
+    x = d(gen);
+  return v;
+}
+
+// Upsample by L, filter with h, keep every M-th sample
+std::vector<complex<double>>
+reference(std::size_t L, std::size_t M, const std::vector<double> &h, const std::vector<complex<double>> &x)
+{
+  std::vector<complex<double>> y;
+  for (std::size_t t = 0; t < x.size() * L; t += M)
+  {
+    double re = 0.0, im = 0.0;
+    for (std::size_t k = 0; k < h.size() && k <= t; ++k)
+    {
+      if ((t - k) % L != 0)
+        continue;
+      re += h[k] * x[(t - k) / L].real();
+      im += h[k] * x[(t - k) / L].imag();
+    }
+    y.push_back(complex<double>(re, im));
+  }
+  return y;
+}
+
+// Streams x through r in blocks of pseudo-random length
+template <typename _Resampler>
+std::vector<complex<double>>
+stream(_Resampler &r, const std::vector<complex<double>> &x, unsigned seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<std::size_t> len(0, 700);
+  std::vector<complex<double>> y;
+  std::size_t i = 0;
+  while (i < x.size())
+  {
+    const std::size_t n = std::min(len(gen), x.size() - i);
+    std::vector<complex<double>> out(r.output_size(n));
+    const std::size_t w = r.process(std::span<const complex<double>>(x.data() + i, n), std::span(out));
+    EXPECT_LE(w, r.output_size(n));
+    y.insert(y.end(), out.begin(), out.begin() + w);
+    i += n;
+  }
+  return y;
+}
+
+void
+expect_near(const std::vector<complex<double>> &a, const std::vector<complex<double>> &b, double tol)
+{
+  ASSERT_EQ(a.size(), b.size());
+  for (std::size_t i = 0; i < a.size(); ++i)
+  {
+    ASSERT_NEAR(a[i].real(), b[i].real(), tol) << i;
+    ASSERT_NEAR(a[i].imag(), b[i].imag(), tol) << i;
+  }
+}
+} // namespace
+
+//
+// polyphase_resampler
+//
+TEST(PolyphaseResampler, MatchesUpsampleFilterDownsample)
+{
+  const auto x = noise(3001, 1);
+  const std::size_t ratios[][2] = {{147, 160}, {1, 10}, {3, 2}, {5, 1}, {4, 6}, {1, 1}};
+  for (const auto &ratio : ratios)
+  {
+    const auto h = real_noise(37 + ratio[0], ratio[0] + ratio[1]);
+    polyphase_resampler<double> r(ratio[0], ratio[1], std::span<const double>(h));
+    EXPECT_EQ(r.taps_per_phase() % 8, 0u);
+    expect_near(stream(r, x, 2), reference(ratio[0], ratio[1], h, x), 1e-10);
+  }
+}
+
+TEST(PolyphaseResampler, BlockSplitAndResetDoNotMatter)
+{
+  const auto x = noise(5000, 3);
+  polyphase_resampler<double> r(160, 147);
+  EXPECT_EQ(r.up(), 160u);
+  EXPECT_EQ(r.down(), 147u);
+
+  const auto a = stream(r, x, 4);
+  EXPECT_EQ(a.size(), (x.size() * 160 + 146) / 147);
+  r.reset();
+  std::vector<complex<double>> b(r.output_size(x.size()));
+  b.resize(r.process(x.data(), b.data(), x.size()));
+  expect_near(a, b, 0.0);
+
+  // The ratio is reduced to lowest terms
+  polyphase_resampler<double> d(20, 200);
+  EXPECT_EQ(d.up(), 1u);
+  EXPECT_EQ(d.down(), 10u);
+}
+
+TEST(PolyphaseResampler, DesignedFilterPreservesInBandTone)
+{
+  // 48 kHz -> 44.1 kHz, tone at 0.05 of the input rate
+  const std::size_t n = 9600;
+  const double f = 0.05;
+  std::vector<complex<double>> x(n);
+  for (std::size_t i = 0; i < n; ++i)
+    x[i] = complex<double>(std::cos(2 * std::numbers::pi * f * i), std::sin(2 * std::numbers::pi * f * i));
+
+  polyphase_resampler<double> r(147, 160);
+  std::vector<complex<double>> y(r.output_size(n));
+  y.resize(r.process(x.data(), y.data(), n));
+  ASSERT_EQ(y.size(), (n * 147 + 159) / 160);
+
+  // Past the filter's start up, the output is the same tone at the new
+  // rate with unit amplitude
+  const double g = f * 160.0 / 147.0;
+  for (std::size_t m = 1000; m + 1 < y.size(); ++m)
+  {
+    EXPECT_NEAR(std::hypot(y[m].real(), y[m].imag()), 1.0, 1e-3) << m;
+    const double dphase = std::arg(std::complex<double>(y[m + 1].real(), y[m + 1].imag())
+                                   * std::conj(std::complex<double>(y[m].real(), y[m].imag())));
+    EXPECT_NEAR(dphase, 2 * std::numbers::pi * g, 1e-3) << m;
+  }
+}
+
+TEST(PolyphaseResampler, RejectsBadArguments)
+{
+  const std::vector<double> h(8, 1.0);
+  EXPECT_THROW(polyphase_resampler<double>(0, 1, std::span<const double>(h)), std::invalid_argument);
+  EXPECT_THROW(polyphase_resampler<double>(1, 0), std::invalid_argument);
+  EXPECT_THROW(polyphase_resampler<double>(2, 3, std::span<const double>()), std::invalid_argument);
+  EXPECT_THROW(polyphase_resampler<double>(2, 3, std::size_t(0)), std::invalid_argument);
+}
+
+//
+// halfband_decimator
+//
+TEST(HalfbandDecimator, MatchesFilterAndDownsample)
+{
+  const auto x = noise(4001, 5);
+  for (std::size_t taps : {3u, 7u, 31u, 63u})
+  {
+    // An exact half-band filter: zero at even, nonzero offsets from the
+    // center, symmetric otherwise
+    const std::size_t c = (taps - 1) / 2;
+    auto h = real_noise(taps, static_cast<unsigned>(taps));
+    for (std::size_t k = 0; k < taps; ++k)
+    {
+      if (k != c && (k % 2) == (c % 2))
+        h[k] = 0.0;
+      if (k > c)
+        h[k] = h[taps - 1 - k];
+    }
+    halfband_decimator<double> d(std::span<const double>(h.data(), h.size()));
+    EXPECT_EQ(d.taps(), taps);
+    const auto y = stream(d, x, 6);
+    EXPECT_EQ(y.size(), (x.size() + 1) / 2);
+    expect_near(y, reference(1, 2, h, x), 1e-10);
+  }
+}
+
+TEST(HalfbandDecimator, DesignedFilterAgreesWithPolyphase)
+{
+  const auto x = noise(3000, 7);
+  halfband_decimator<double> d(47);
+  EXPECT_EQ(d.taps(), 47u);
+  const auto a = stream(d, x, 8);
+  d.reset();
+  const auto b = stream(d, x, 9);
+  expect_near(a, b, 0.0);
+
+  // The same filter through the generic path; the taps at even offsets
+  // that the decimator skips are zero only up to rounding
+  std::vector<double> h(47);
+  const auto design = hypercomplex::__detail::__kaiser_lowpass<double>(47, 0.25, 1.0);
+  for (std::size_t k = 0; k < 47; ++k)
+    h[k] = design[k];
+  polyphase_resampler<double> r(1, 2, std::span<const double>(h));
+  expect_near(a, stream(r, x, 10), 1e-12);
+
+  EXPECT_THROW(halfband_decimator<double>(std::span<const double>(h.data(), 45)), std::invalid_argument);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : resampler_tests.cpp
+// footer-end --------------------------------------------
@@ -0,0 +1,170 @@
+// header-begin ------------------------------------------
+// File       : ring_tests.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// header-end --------------------------------------------
+
+#include <gtest/gtest.h>
+
+#include "hypercomplex/ring.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using hypercomplex::complex;
+using hypercomplex::mpmc_ring;
+using hypercomplex::spsc_ring;
+using hypercomplex::wait_policy;
+
+namespace
+{
+// Producer writes blocks whose samples carry (block, index); the consumer
+// checks order and contents.
+template <wait_policy W>
+void
+spsc_transfer(std::size_t blocks)
+{
+  spsc_ring<float, W> ring(4, 37);
+  std::thread producer(
+      [&]
+      {
+        for (std::size_t b = 0; b < blocks; ++b)
+        {
+          auto s = ring.reserve();
+          const std::size_t n = 1 + b % ring.block_size();
+          for (std::size_t i = 0; i < n; ++i)
+            s[i] = complex<float>(static_cast<float>(b), static_cast<float>(i));
+          ring.commit(n);
+        }
+        ring.close();
+      });
+
+  std::size_t expected = 0;
+  for (auto s = ring.acquire(); !s.empty(); s = ring.acquire())
+  {
+    ASSERT_EQ(s.size(), 1 + expected % ring.block_size());
+    for (std::size_t i = 0; i < s.size(); ++i)
+      ASSERT_EQ(s[i], complex<float>(static_cast<float>(expected), static_cast<float>(i)));
+    ring.release();
+    ++expected;
+  }
+  producer.join();
+  EXPECT_EQ(expected, blocks);
+}
+
+template <wait_policy W>
+void
+mpmc_transfer(int producers, int consumers, int per_producer)
+{
+  mpmc_ring<double, W> ring(8, 4);
+  std::vector<std::atomic<int>> seen(producers * per_producer);
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p)
+    threads.emplace_back(
+        [&, p]
+        {
+          for (int i = 0; i < per_producer; ++i)
+          {
+            auto h = ring.reserve();
+            h.data[0] = complex<double>(p * per_producer + i, 0.0);
+            ring.commit(h, 1);
+          }
+        });
+  for (int c = 0; c < consumers; ++c)
+    threads.emplace_back(
+        [&]
+        {
+          for (auto h = ring.acquire(); h; h = ring.acquire())
+          {
+            seen[static_cast<std::size_t>(h.data[0].real())].fetch_add(1);
+            ring.release(h);
+          }
+        });
+  for (int p = 0; p < producers; ++p)
+    threads[p].join();
+  ring.close();
+  for (std::size_t t = producers; t < threads.size(); ++t)
+    threads[t].join();
+
+  for (const auto &s : seen)
+    ASSERT_EQ(s.load(), 1);
+}
+} // namespace
+
+TEST(SPSCRing, TryReserveAndAcquireAtTheBounds)
+{
+  spsc_ring<float> ring(3, 10);
+  EXPECT_EQ(ring.capacity(), 4u);
+  EXPECT_TRUE(ring.try_acquire().empty());
+  for (int i = 0; i < 4; ++i)
+  {
+    auto s = ring.try_reserve();
+    ASSERT_EQ(s.size(), 10u);
+    // Blocks start on their own cache line
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(s.data()) % 64, 0u);
+    ring.commit(i + 1);
+  }
+  EXPECT_TRUE(ring.try_reserve().empty());
+
+  EXPECT_EQ(ring.try_acquire().size(), 1u);
+  ring.release();
+  EXPECT_FALSE(ring.try_reserve().empty());
+  ring.close();
+  EXPECT_EQ(ring.acquire().size(), 2u);
+}
+
+TEST(SPSCRing, TransfersInOrderWithFutexWait)
+{
+  spsc_transfer<wait_policy::futex>(20000);
+}
+
+TEST(SPSCRing, TransfersInOrderWithBusyPoll)
+{
+  spsc_transfer<wait_policy::busy_poll>(20000);
+}
+
+TEST(MPMCRing, TryReserveAndAcquireAtTheBounds)
+{
+  mpmc_ring<float> ring(2, 3);
+  auto a = ring.try_reserve(), b = ring.try_reserve();
+  ASSERT_TRUE(a && b);
+  EXPECT_FALSE(ring.try_reserve());
+  EXPECT_FALSE(ring.try_acquire());
+
+  // Committed out of order; consumers still see reservation order
+  ring.commit(b, 2);
+  EXPECT_FALSE(ring.try_acquire());
+  ring.commit(a, 1);
+  auto r = ring.try_acquire();
+  ASSERT_TRUE(r);
+  EXPECT_EQ(r.data.size(), 1u);
+  ring.release(r);
+  EXPECT_TRUE(ring.try_reserve());
+}
+
+TEST(MPMCRing, EveryBlockDeliveredOnceWithFutexWait)
+{
+  mpmc_transfer<wait_policy::futex>(4, 3, 5000);
+}
+
+TEST(MPMCRing, EveryBlockDeliveredOnceWithBusyPoll)
+{
+  mpmc_transfer<wait_policy::busy_poll>(2, 2, 5000);
+}
+
+int
+main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : ring_tests.cpp
+// footer-end --------------------------------------------
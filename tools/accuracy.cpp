@@ -0,0 +1,548 @@
+// header-begin ------------------------------------------
+// File       : accuracy.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Accuracy versus speed characterization of the
+//      functions in complex.hpp and batch.hpp. Every
+//      function is run over a structured grid of edge cases
+//      (the r = 0 / inf / nan / negative cases of main.cpp
+//      included) and over random inputs, and compared with
+//      a long double reference computed through
+//      std::complex<long double>.
+//
+//      Usage: complex_accuracy [--format csv|json]
+//                              [--samples N] [--seed S]
+//
+//      One row per (type, backend, function, domain):
+//          max_ulp / mean_ulp : |result - reference| in units
+//                               of the last place of the
+//                               largest reference component
+//          special_mismatch   : samples where the result and
+//                               the reference disagree on a
+//                               non-finite value
+//          ns_per_element     : wall time per evaluation
+//
+// header-end --------------------------------------------
+
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/complex.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+using hypercomplex::accuracy;
+using hypercomplex::complex;
+using reference_t = std::complex<long double>;
+
+namespace
+{
+struct options
+{
+	bool json = false;
+	std::size_t samples = 1 << 16;
+	std::uint64_t seed = 2025;
+};
+
+struct row
+{
+	std::string type, backend, function, domain;
+	std::size_t samples;
+	double max_ulp, mean_ulp;
+	std::size_t special_mismatch;
+	double ns_per_element;
+};
+
+// Inputs of one domain. Unary functions read a, binary ones a and b,
+// polar reads (rho, theta) = (a.real(), a.imag()) from the split arrays.
+template <typename _Tp> struct inputs
+{
+	std::vector<complex<_Tp>> a, b;
+	std::vector<_Tp> rho, theta;
+};
+
+template <typename _Tp> struct test_case
+{
+	const char *backend;
+	const char *function;
+	std::function<void(const inputs<_Tp> &, std::vector<complex<_Tp>> &)> run;
+	std::function<reference_t(const complex<_Tp> &, const complex<_Tp> &)> reference;
+};
+
+template <typename _Tp>
+const char *
+type_name()
+{
+	return std::is_same_v<_Tp, float> ? "float" : "double";
+}
+
+template <typename _Tp>
+inputs<_Tp>
+make_inputs(std::vector<complex<_Tp>> a)
+{
+	inputs<_Tp> in;
+	in.a = std::move(a);
+	in.b.resize(in.a.size());
+	for (std::size_t i = 0; i < in.a.size(); ++i)
+	{
+		// Pair every value with a different one for the binary operators
+		in.b[i] = in.a[(i * 7 + 3) % in.a.size()];
+		in.rho.push_back(in.a[i].real());
+		in.theta.push_back(in.a[i].imag());
+	}
+	return in;
+}
+
+// Every pair of edge values, including the cases exercised by main.cpp
+template <typename _Tp>
+inputs<_Tp>
+structured_inputs()
+{
+	using limits = std::numeric_limits<_Tp>;
+	const _Tp values[] = {_Tp(0),
+						  -_Tp(0),
+						  limits::denorm_min(),
+						  limits::min(),
+						  _Tp(0.5),
+						  _Tp(1),
+						  _Tp(-1),
+						  _Tp(2),
+						  static_cast<_Tp>(hypercomplex::__pi),
+						  -static_cast<_Tp>(hypercomplex::__pi),
+						  _Tp(10),
+						  _Tp(-100),
+						  _Tp(1e6),
+						  limits::max(),
+						  -limits::max(),
+						  limits::infinity(),
+						  -limits::infinity(),
+						  limits::quiet_NaN()};
+	std::vector<complex<_Tp>> a;
+	for (_Tp re : values)
+	{
+		for (_Tp im : values)
+		{
+			a.emplace_back(re, im);
+		}
+	}
+	return make_inputs(std::move(a));
+}
+
+// Random signs and magnitudes spread log-uniformly over [2^-8, 2^8]
+template <typename _Tp>
+inputs<_Tp>
+random_inputs(const options &opt)
+{
+	std::mt19937_64 gen(opt.seed);
+	std::uniform_real_distribution<double> exponent(-8.0, 8.0);
+	std::bernoulli_distribution negative(0.5);
+	auto draw = [&] { return static_cast<_Tp>((negative(gen) ? -1.0 : 1.0) * std::exp2(exponent(gen))); };
+	std::vector<complex<_Tp>> a;
+	for (std::size_t i = 0; i < opt.samples; ++i)
+	{
+		const _Tp re = draw();
+		a.emplace_back(re, draw());
+	}
+	return make_inputs(std::move(a));
+}
+
+// Error of got against ref in units of the last place of _Tp
+template <typename _Tp>
+double
+ulp_error(const complex<_Tp> &got, const reference_t &ref, bool &special)
+{
+	const _Tp ref_re = static_cast<_Tp>(ref.real()), ref_im = static_cast<_Tp>(ref.imag());
+	special = false;
+	if (!std::isfinite(ref_re) || !std::isfinite(ref_im) || !std::isfinite(got.real()) || !std::isfinite(got.imag()))
+	{
+		auto same = [](_Tp x, _Tp y) { return (std::isnan(x) && std::isnan(y)) || x == y; };
+		special = !same(got.real(), ref_re) || !same(got.imag(), ref_im);
+		return 0.0;
+	}
+	const _Tp scale = std::max(std::abs(ref_re), std::abs(ref_im));
+	const _Tp next = std::nextafter(scale, std::numeric_limits<_Tp>::infinity());
+	const long double ulp = scale == _Tp(0) ? std::numeric_limits<_Tp>::denorm_min() : next - scale;
+	const long double dr = static_cast<long double>(got.real()) - ref.real();
+	const long double di = static_cast<long double>(got.imag()) - ref.imag();
+	return static_cast<double>(std::hypot(dr, di) / ulp);
+}
+
+template <typename _Tp>
+double
+time_ns_per_element(const test_case<_Tp> &tc, const inputs<_Tp> &in, std::vector<complex<_Tp>> &out)
+{
+	using clock = std::chrono::steady_clock;
+	std::size_t reps = 0;
+	const auto start = clock::now();
+	auto elapsed = clock::duration::zero();
+	while (reps < 3 || elapsed < std::chrono::milliseconds(20))
+	{
+		tc.run(in, out);
+		++reps;
+		elapsed = clock::now() - start;
+	}
+	return std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(reps * in.a.size());
+}
+
+template <typename _Tp>
+row
+measure(const test_case<_Tp> &tc, const inputs<_Tp> &in, const char *domain)
+{
+	std::vector<complex<_Tp>> out(in.a.size());
+	tc.run(in, out);
+
+	double max_ulp = 0.0, sum_ulp = 0.0;
+	std::size_t special = 0, counted = 0;
+	for (std::size_t i = 0; i < in.a.size(); ++i)
+	{
+		bool mismatch = false;
+		const double e = ulp_error(out[i], tc.reference(in.a[i], in.b[i]), mismatch);
+		special += mismatch;
+		if (!mismatch)
+		{
+			max_ulp = std::max(max_ulp, e);
+			sum_ulp += e;
+			++counted;
+		}
+	}
+	const double ns = time_ns_per_element(tc, in, out);
+	return row{type_name<_Tp>(), tc.backend,	 tc.function, domain, in.a.size(), max_ulp,
+			   counted != 0 ? sum_ulp / static_cast<double>(counted) : 0.0, special, ns};
+}
+
+reference_t
+to_reference(long double re, long double im = 0.0L)
+{
+	return reference_t(re, im);
+}
+template <typename _Tp>
+reference_t
+to_reference(const complex<_Tp> &z)
+{
+	return reference_t(z.real(), z.imag());
+}
+
+// Mathematical polar(rho, theta) with the conventions documented for
+// hypercomplex::polar: |rho| is used and non-finite theta or NaN rho
+// give (NaN, NaN).
+reference_t
+polar_reference(long double rho, long double theta)
+{
+	const long double nan = std::numeric_limits<long double>::quiet_NaN();
+	if (std::isnan(rho) || !std::isfinite(theta))
+	{
+		return reference_t(nan, nan);
+	}
+	const long double c = std::cos(theta), s = std::sin(theta);
+	return reference_t(c == 0 ? c : std::abs(rho) * c, s == 0 ? s : std::abs(rho) * s);
+}
+
+// z^w with the zero base conventions of hypercomplex::pow: 0^0 = 1,
+// 0 for Re w > 0, an infinite modulus (real when w is) for Re w < 0 and
+// (NaN, NaN) otherwise. Other bases are exp(w log z).
+reference_t
+pow_reference(const reference_t &z, const reference_t &w)
+{
+	const long double inf = std::numeric_limits<long double>::infinity();
+	const long double nan = std::numeric_limits<long double>::quiet_NaN();
+	if (z != reference_t(0))
+	{
+		return std::exp(w * std::log(z));
+	}
+	if (w == reference_t(0))
+	{
+		return reference_t(1);
+	}
+	if (w.real() > 0 && !std::isnan(w.imag()))
+	{
+		return reference_t(0);
+	}
+	if (w.real() < 0 && !std::isnan(w.imag()))
+	{
+		return reference_t(inf, w.imag() == 0 ? 0.0L : nan);
+	}
+	return reference_t(nan, nan);
+}
+
+// Applies a scalar function of one complex argument to every input
+template <typename _Tp, typename _Function>
+std::function<void(const inputs<_Tp> &, std::vector<complex<_Tp>> &)>
+unary(_Function f)
+{
+	return [f](const inputs<_Tp> &in, std::vector<complex<_Tp>> &out)
+	{
+		for (std::size_t i = 0; i < in.a.size(); ++i)
+		{
+			out[i] = complex<_Tp>(f(in.a[i]));
+		}
+	};
+}
+template <typename _Tp, typename _Function>
+std::function<void(const inputs<_Tp> &, std::vector<complex<_Tp>> &)>
+binary(_Function f)
+{
+	return [f](const inputs<_Tp> &in, std::vector<complex<_Tp>> &out)
+	{
+		for (std::size_t i = 0; i < in.a.size(); ++i)
+		{
+			out[i] = complex<_Tp>(f(in.a[i], in.b[i]));
+		}
+	};
+}
+
+template <typename _Tp>
+complex<_Tp>
+from_std(const std::complex<_Tp> &z)
+{
+	return complex<_Tp>(z.real(), z.imag());
+}
+template <typename _Tp>
+std::complex<_Tp>
+to_std(const complex<_Tp> &z)
+{
+	return std::complex<_Tp>(z.real(), z.imag());
+}
+
+// Every function of complex.hpp that currently has an implementation.
+// acos, asin, atan, acot, acosh, asinh, atanh, acoth, sqrt and proj are
+// still empty and are skipped; tan and cot only compile for float, tanh
+// and coth for no type yet. pow is swept at fixed exponents, one per
+// overload: the integers 5 and -3, the real 2.5 and the complex w below.
+template <typename _Tp>
+std::vector<test_case<_Tp>>
+test_cases()
+{
+	using z = complex<_Tp>;
+	using R = reference_t;
+	auto ref_unary = [](R (*f)(const R &))
+	{ return [f](const z &a, const z &) { return f(to_reference(a)); }; };
+	auto ref_binary = [](R (*f)(const R &, const R &))
+	{ return [f](const z &a, const z &b) { return f(to_reference(a), to_reference(b)); }; };
+
+	std::vector<test_case<_Tp>> cases;
+
+	// Operators
+	cases.push_back({"scalar", "operator+", binary<_Tp>([](const z &a, const z &b) { return a + b; }),
+					 ref_binary([](const R &a, const R &b) { return a + b; })});
+	cases.push_back({"scalar", "operator-", binary<_Tp>([](const z &a, const z &b) { return a - b; }),
+					 ref_binary([](const R &a, const R &b) { return a - b; })});
+	cases.push_back({"scalar", "operator*", binary<_Tp>([](const z &a, const z &b) { return a * b; }),
+					 ref_binary([](const R &a, const R &b) { return a * b; })});
+	cases.push_back({"scalar", "operator/", binary<_Tp>([](const z &a, const z &b) { return a / b; }),
+					 ref_binary([](const R &a, const R &b) { return a / b; })});
+	cases.push_back({"std", "operator*", binary<_Tp>([](const z &a, const z &b) { return from_std(to_std(a) * to_std(b)); }),
+					 ref_binary([](const R &a, const R &b) { return a * b; })});
+	cases.push_back({"std", "operator/", binary<_Tp>([](const z &a, const z &b) { return from_std(to_std(a) / to_std(b)); }),
+					 ref_binary([](const R &a, const R &b) { return a / b; })});
+
+	// Mathematical functions
+	cases.push_back({"scalar", "abs", unary<_Tp>([](const z &a) { return z(abs(a)); }),
+					 ref_unary([](const R &a) { return to_reference(std::abs(a)); })});
+	cases.push_back({"scalar", "arg", unary<_Tp>([](const z &a) { return z(arg(a)); }),
+					 ref_unary([](const R &a) { return to_reference(std::arg(a)); })});
+	cases.push_back({"scalar", "norm", unary<_Tp>([](const z &a) { return z(norm(a)); }),
+					 ref_unary([](const R &a) { return to_reference(std::norm(a)); })});
+	cases.push_back({"scalar", "conj", unary<_Tp>([](const z &a) { return conj(a); }),
+					 ref_unary([](const R &a) { return std::conj(a); })});
+	cases.push_back({"scalar", "polar",
+					 [](const inputs<_Tp> &in, std::vector<z> &out)
+					 {
+						 for (std::size_t i = 0; i < in.a.size(); ++i)
+						 {
+							 out[i] = hypercomplex::polar(in.rho[i], in.theta[i]);
+						 }
+					 },
+					 [](const z &a, const z &) { return polar_reference(a.real(), a.imag()); }});
+	cases.push_back({"std", "abs", unary<_Tp>([](const z &a) { return z(std::abs(to_std(a))); }),
+					 ref_unary([](const R &a) { return to_reference(std::abs(a)); })});
+	cases.push_back({"std", "arg", unary<_Tp>([](const z &a) { return z(std::arg(to_std(a))); }),
+					 ref_unary([](const R &a) { return to_reference(std::arg(a)); })});
+
+	// Transcendentals
+	cases.push_back({"scalar", "cos", unary<_Tp>([](const z &a) { return cos(a); }),
+					 ref_unary([](const R &a) { return std::cos(a); })});
+	cases.push_back({"scalar", "sin", unary<_Tp>([](const z &a) { return sin(a); }),
+					 ref_unary([](const R &a) { return std::sin(a); })});
+	cases.push_back({"scalar", "cosh", unary<_Tp>([](const z &a) { return cosh(a); }),
+					 ref_unary([](const R &a) { return std::cosh(a); })});
+	cases.push_back({"scalar", "sinh", unary<_Tp>([](const z &a) { return sinh(a); }),
+					 ref_unary([](const R &a) { return std::sinh(a); })});
+	if constexpr (std::is_same_v<_Tp, float>)
+	{
+		cases.push_back({"scalar", "tan", unary<_Tp>([](const z &a) { return tan(a); }),
+						 ref_unary([](const R &a) { return std::tan(a); })});
+		cases.push_back({"scalar", "cot", unary<_Tp>([](const z &a) { return cot(a); }),
+						 ref_unary([](const R &a) { return R(1) / std::tan(a); })});
+	}
+	cases.push_back({"scalar", "exp", unary<_Tp>([](const z &a) { return exp(a); }),
+					 ref_unary([](const R &a) { return std::exp(a); })});
+	cases.push_back({"scalar", "log", unary<_Tp>([](const z &a) { return log(a); }),
+					 ref_unary([](const R &a) { return std::log(a); })});
+	cases.push_back({"scalar", "log10", unary<_Tp>([](const z &a) { return log10(a); }),
+					 ref_unary([](const R &a) { return std::log10(a); })});
+
+	// Powers, one row per exponent
+	const z w(_Tp(0.75), _Tp(1.25));
+	const R rw(0.75L, 1.25L);
+	auto ref_pow = [rw](const z &a, const z &) { return pow_reference(to_reference(a), rw); };
+	cases.push_back({"scalar", "pow_int5", unary<_Tp>([](const z &a) { return pow(a, 5); }),
+					 ref_unary([](const R &a) { return a * a * a * a * a; })});
+	cases.push_back({"scalar", "pow_int-3", unary<_Tp>([](const z &a) { return pow(a, -3); }),
+					 ref_unary([](const R &a) { return R(1) / (a * a * a); })});
+	cases.push_back({"scalar", "pow_real2.5", unary<_Tp>([](const z &a) { return pow(a, _Tp(2.5)); }),
+					 ref_unary([](const R &a) { return pow_reference(a, R(2.5L)); })});
+	cases.push_back({"scalar", "pow_complex", unary<_Tp>([w](const z &a) { return pow(a, w); }), ref_pow});
+	cases.push_back({"std", "pow_complex",
+					 unary<_Tp>([w](const z &a) { return from_std(std::pow(to_std(a), to_std(w))); }), ref_pow});
+	cases.push_back({"batch", "pow_int5",
+					 [](const inputs<_Tp> &in, std::vector<z> &out) { hypercomplex::pow<_Tp>(in.a, 5, out); },
+					 ref_unary([](const R &a) { return a * a * a * a * a; })});
+	cases.push_back({"batch", "pow_int-3",
+					 [](const inputs<_Tp> &in, std::vector<z> &out) { hypercomplex::pow<_Tp>(in.a, -3, out); },
+					 ref_unary([](const R &a) { return R(1) / (a * a * a); })});
+
+	cases.push_back({"std", "cos", unary<_Tp>([](const z &a) { return from_std(std::cos(to_std(a))); }),
+					 ref_unary([](const R &a) { return std::cos(a); })});
+	cases.push_back({"std", "sin", unary<_Tp>([](const z &a) { return from_std(std::sin(to_std(a))); }),
+					 ref_unary([](const R &a) { return std::sin(a); })});
+
+	// Batch kernels, one backend per accuracy level
+	const std::pair<const char *, accuracy> levels[] = {
+		{"batch_fast", accuracy::fast}, {"batch_balanced", accuracy::balanced}, {"batch_precise", accuracy::precise}};
+	for (const auto &[backend, level] : levels)
+	{
+		const accuracy acc = level;
+		cases.push_back({backend, "abs",
+						 [acc](const inputs<_Tp> &in, std::vector<z> &out)
+						 {
+							 thread_local std::vector<_Tp> mag, phase;
+							 mag.resize(in.a.size());
+							 phase.resize(in.a.size());
+							 hypercomplex::to_polar<_Tp>(in.a, mag, phase, acc);
+							 for (std::size_t i = 0; i < mag.size(); ++i)
+							 {
+								 out[i] = z(mag[i]);
+							 }
+						 },
+						 ref_unary([](const R &a) { return to_reference(std::abs(a)); })});
+		cases.push_back({backend, "arg",
+						 [acc](const inputs<_Tp> &in, std::vector<z> &out)
+						 {
+							 thread_local std::vector<_Tp> mag, phase;
+							 mag.resize(in.a.size());
+							 phase.resize(in.a.size());
+							 hypercomplex::to_polar<_Tp>(in.a, mag, phase, acc);
+							 for (std::size_t i = 0; i < phase.size(); ++i)
+							 {
+								 out[i] = z(phase[i]);
+							 }
+						 },
+						 ref_unary([](const R &a) { return to_reference(std::arg(a)); })});
+		cases.push_back({backend, "polar",
+						 [acc](const inputs<_Tp> &in, std::vector<z> &out)
+						 { hypercomplex::from_polar<_Tp>(in.rho, in.theta, out, acc); },
+						 [](const z &a, const z &) { return polar_reference(a.real(), a.imag()); }});
+		cases.push_back({backend, "pow_real2.5",
+						 [acc](const inputs<_Tp> &in, std::vector<z> &out)
+						 { hypercomplex::pow<_Tp>(in.a, _Tp(2.5), out, acc); },
+						 ref_unary([](const R &a) { return pow_reference(a, R(2.5L)); })});
+		cases.push_back({backend, "pow_complex",
+						 [acc, w](const inputs<_Tp> &in, std::vector<z> &out)
+						 { hypercomplex::pow<_Tp>(in.a, w, out, acc); },
+						 ref_pow});
+	}
+	return cases;
+}
+
+template <typename _Tp>
+void
+run_type(const options &opt, std::vector<row> &rows)
+{
+	const inputs<_Tp> structured = structured_inputs<_Tp>();
+	const inputs<_Tp> random = random_inputs<_Tp>(opt);
+	for (const auto &tc : test_cases<_Tp>())
+	{
+		rows.push_back(measure(tc, structured, "structured"));
+		rows.push_back(measure(tc, random, "random"));
+	}
+}
+
+void
+print_csv(const std::vector<row> &rows)
+{
+	std::printf("type,backend,function,domain,samples,max_ulp,mean_ulp,special_mismatch,ns_per_element\n");
+	for (const row &r : rows)
+	{
+		std::printf("%s,%s,%s,%s,%zu,%.6g,%.6g,%zu,%.4f\n", r.type.c_str(), r.backend.c_str(), r.function.c_str(),
+					r.domain.c_str(), r.samples, r.max_ulp, r.mean_ulp, r.special_mismatch, r.ns_per_element);
+	}
+}
+
+void
+print_json(const std::vector<row> &rows)
+{
+	std::printf("[\n");
+	for (std::size_t i = 0; i < rows.size(); ++i)
+	{
+		const row &r = rows[i];
+		std::printf("  {\"type\": \"%s\", \"backend\": \"%s\", \"function\": \"%s\", \"domain\": \"%s\", "
+					"\"samples\": %zu, \"max_ulp\": %.6g, \"mean_ulp\": %.6g, \"special_mismatch\": %zu, "
+					"\"ns_per_element\": %.4f}%s\n",
+					r.type.c_str(), r.backend.c_str(), r.function.c_str(), r.domain.c_str(), r.samples, r.max_ulp,
+					r.mean_ulp, r.special_mismatch, r.ns_per_element, i + 1 < rows.size() ? "," : "");
+	}
+	std::printf("]\n");
+}
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+	options opt;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+		{
+			opt.json = std::strcmp(argv[++i], "json") == 0;
+		}
+		else if (std::strcmp(argv[i], "--samples") == 0 && i + 1 < argc)
+		{
+			opt.samples = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+		{
+			opt.seed = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else
+		{
+			std::fprintf(stderr, "usage: %s [--format csv|json] [--samples N] [--seed S]\n", argv[0]);
+			return 2;
+		}
+	}
+
+	std::vector<row> rows;
+	run_type<float>(opt, rows);
+	run_type<double>(opt, rows);
+	opt.json ? print_json(rows) : print_csv(rows);
+	return 0;
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : accuracy.cpp
+// footer-end --------------------------------------------
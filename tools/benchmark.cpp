@@ -0,0 +1,616 @@
+// header-begin ------------------------------------------
+// File       : benchmark.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Throughput of the kernels in complex.hpp and
+//      batch.hpp and of LU factorization, with hardware
+//      performance counters read through perf_event_open
+//      around each timed loop. Each event is opened on its
+//      own, so a counter the kernel, the CPU or the
+//      container does not provide costs only its own column;
+//      with none at all (non-Linux hosts, perf_event_paranoid,
+//      virtual machines without a PMU) the timings are still
+//      reported.
+//
+//      Usage: complex_benchmark [--format csv|json]
+//                               [--size N] [--min-time MS]
+//                               [--seed S] [--filter TEXT]
+//                               [--scalar-event RAW]
+//                               [--vector-event RAW]
+//
+//      One row per (type, backend, kernel), counts per
+//      element. The solver/lu_factor row factors a matrix of
+//      side floor(sqrt(N)), so its counts are per matrix
+//      element when N is a square, each element costing
+//      about (8/3) sqrt(N) real flops. The fir rows stream
+//      through a 256-tap overlap-save filter in 64-sample
+//      calls and in one call; the two should cost the same
+//      per sample:
+//          ns             : mean wall time
+//          ns_best        : wall time of the fastest call,
+//                           which is far less sensitive to
+//                           other load on the machine
+//          cycles, instructions, ipc
+//          l1d_misses     : L1 data cache read misses
+//          llc_misses     : last level cache misses
+//          fp_scalar      : retired scalar FP instructions
+//          fp_vector      : retired packed (SIMD) FP
+//                           instructions, any width
+//      The FP events have no generic perf encoding. On Intel
+//      CPUs FP_ARITH_INST_RETIRED is used (raw 0x03c7 and
+//      0xfcc7); elsewhere they are reported only when given
+//      as raw event codes. A counter that is missing prints
+//      as an empty CSV field or a JSON null.
+//
+// header-end --------------------------------------------
+
+#include "hypercomplex/batch.hpp"
+#include "hypercomplex/complex.hpp"
+#include "hypercomplex/fir.hpp"
+#include "hypercomplex/lu.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#endif
+
+using hypercomplex::accuracy;
+using hypercomplex::complex;
+
+namespace
+{
+struct options
+{
+	bool json = false;
+	std::size_t size = 1 << 14;
+	double min_ms = 50.0;
+	std::uint64_t seed = 2025;
+	std::string filter;
+	// Raw PMU encodings (event | umask << 8); zero means the default
+	std::uint64_t scalar_event = 0, vector_event = 0;
+};
+
+enum counter : std::size_t
+{
+	cycles,
+	instructions,
+	l1d_misses,
+	llc_misses,
+	fp_scalar,
+	fp_vector,
+	counter_count
+};
+
+const char *const counter_names[counter_count]
+	= {"cycles", "instructions", "l1d_misses", "llc_misses", "fp_scalar", "fp_vector"};
+
+using counter_values = std::array<double, counter_count>;
+
+bool
+is_intel()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	unsigned a, b, c, d;
+	if (__get_cpuid(0, &a, &b, &c, &d) == 0)
+	{
+		return false;
+	}
+	char vendor[13] = {};
+	std::memcpy(vendor, &b, 4);
+	std::memcpy(vendor + 4, &d, 4);
+	std::memcpy(vendor + 8, &c, 4);
+	return std::strcmp(vendor, "GenuineIntel") == 0;
+#else
+	return false;
+#endif
+}
+
+// Counters for the calling thread, user space only. Values are scaled
+// by time_enabled / time_running when the kernel multiplexes them.
+class perf_counters
+{
+  private:
+	std::array<int, counter_count> _fd;
+	std::string _status = "ok";
+
+#if defined(__linux__)
+	static int
+	open_event(std::uint32_t type, std::uint64_t config)
+	{
+		perf_event_attr attr;
+		std::memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.type = type;
+		attr.config = config;
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+#endif
+
+  public:
+	explicit perf_counters(const options &opt)
+	{
+		_fd.fill(-1);
+#if defined(__linux__)
+		constexpr std::uint64_t l1d_read_miss = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+												| (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		_fd[cycles] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+		const int error = errno;
+		_fd[instructions] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+		_fd[l1d_misses] = open_event(PERF_TYPE_HW_CACHE, l1d_read_miss);
+		_fd[llc_misses] = open_event(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+		const bool intel = is_intel();
+		const std::uint64_t scalar = opt.scalar_event != 0 ? opt.scalar_event : intel ? 0x03c7 : 0;
+		const std::uint64_t vector = opt.vector_event != 0 ? opt.vector_event : intel ? 0xfcc7 : 0;
+		if (scalar != 0)
+		{
+			_fd[fp_scalar] = open_event(PERF_TYPE_RAW, scalar);
+		}
+		if (vector != 0)
+		{
+			_fd[fp_vector] = open_event(PERF_TYPE_RAW, vector);
+		}
+		if (_fd[cycles] < 0 && _fd[instructions] < 0)
+		{
+			_status = std::string("perf_event_open failed (") + std::strerror(error)
+					  + "); check /proc/sys/kernel/perf_event_paranoid";
+		}
+#else
+		(void)opt;
+		_status = "hardware counters are only supported on Linux";
+#endif
+	}
+	~perf_counters()
+	{
+#if defined(__linux__)
+		for (int fd : _fd)
+		{
+			if (fd >= 0)
+			{
+				close(fd);
+			}
+		}
+#endif
+	}
+	perf_counters(const perf_counters &) = delete;
+	perf_counters &operator=(const perf_counters &) = delete;
+
+	bool
+	available(counter c) const
+	{
+		return _fd[c] >= 0;
+	}
+	bool
+	any() const
+	{
+		for (int fd : _fd)
+		{
+			if (fd >= 0)
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+	const std::string &
+	status() const
+	{
+		return _status;
+	}
+
+	void
+	start()
+	{
+#if defined(__linux__)
+		for (int fd : _fd)
+		{
+			if (fd >= 0)
+			{
+				ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+				ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+			}
+		}
+#endif
+	}
+	// NaN for the counters that are missing or never got scheduled
+	counter_values
+	stop()
+	{
+		counter_values values;
+		values.fill(std::nan(""));
+#if defined(__linux__)
+		for (int fd : _fd)
+		{
+			if (fd >= 0)
+			{
+				ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+			}
+		}
+		for (std::size_t c = 0; c < counter_count; ++c)
+		{
+			std::uint64_t data[3];
+			if (_fd[c] >= 0 && read(_fd[c], data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)) && data[2] != 0)
+			{
+				values[c] = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+			}
+		}
+#endif
+		return values;
+	}
+};
+
+struct row
+{
+	std::string type, backend, kernel;
+	std::size_t size;
+	double ns, ns_best;
+	counter_values counts;
+};
+
+template <typename _Tp> struct inputs
+{
+	std::vector<complex<_Tp>> a, b, out;
+	std::vector<_Tp> rho, theta, mag, phase;
+	hypercomplex::matrix<complex<_Tp>> square;
+};
+
+template <typename _Tp> struct kernel
+{
+	const char *backend;
+	const char *name;
+	std::function<void(inputs<_Tp> &)> run;
+};
+
+template <typename _Tp>
+const char *
+type_name()
+{
+	return std::is_same_v<_Tp, float> ? "float" : "double";
+}
+
+// Magnitudes log-uniform over [2^-4, 2^4]: away from the special values,
+// which the accuracy tool covers
+template <typename _Tp>
+inputs<_Tp>
+make_inputs(const options &opt)
+{
+	std::mt19937_64 gen(opt.seed);
+	std::uniform_real_distribution<double> exponent(-4.0, 4.0);
+	std::uniform_real_distribution<double> angle(-3.0, 3.0);
+	std::bernoulli_distribution negative(0.5);
+	auto draw = [&] { return static_cast<_Tp>((negative(gen) ? -1.0 : 1.0) * std::exp2(exponent(gen))); };
+	inputs<_Tp> in;
+	for (std::size_t i = 0; i < opt.size; ++i)
+	{
+		const _Tp re = draw();
+		in.a.emplace_back(re, draw());
+		const _Tp bre = draw();
+		in.b.emplace_back(bre, draw());
+		in.rho.push_back(std::abs(draw()));
+		in.theta.push_back(static_cast<_Tp>(angle(gen)));
+	}
+	in.out.resize(opt.size);
+	in.mag.resize(opt.size);
+	in.phase.resize(opt.size);
+	// The first side^2 values of a, which with draw()'s magnitudes make a
+	// well conditioned matrix almost surely
+	const auto side = static_cast<std::size_t>(std::sqrt(static_cast<double>(opt.size)));
+	in.square = hypercomplex::matrix<complex<_Tp>>(side, side);
+	std::copy_n(in.a.begin(), side * side, in.square.begin());
+	return in;
+}
+
+template <typename _Tp, typename _Function>
+std::function<void(inputs<_Tp> &)>
+unary(_Function f)
+{
+	return [f](inputs<_Tp> &in)
+	{
+		for (std::size_t i = 0; i < in.a.size(); ++i)
+		{
+			in.out[i] = complex<_Tp>(f(in.a[i]));
+		}
+	};
+}
+template <typename _Tp, typename _Function>
+std::function<void(inputs<_Tp> &)>
+binary(_Function f)
+{
+	return [f](inputs<_Tp> &in)
+	{
+		for (std::size_t i = 0; i < in.a.size(); ++i)
+		{
+			in.out[i] = complex<_Tp>(f(in.a[i], in.b[i]));
+		}
+	};
+}
+
+// The scalar functions of complex.hpp that have an implementation for
+// every type (see tools/accuracy.cpp), then the batch kernels
+template <typename _Tp>
+std::vector<kernel<_Tp>>
+kernels()
+{
+	using z = complex<_Tp>;
+	std::vector<kernel<_Tp>> k;
+	k.push_back({"scalar", "operator+", binary<_Tp>([](const z &a, const z &b) { return a + b; })});
+	k.push_back({"scalar", "operator-", binary<_Tp>([](const z &a, const z &b) { return a - b; })});
+	k.push_back({"scalar", "operator*", binary<_Tp>([](const z &a, const z &b) { return a * b; })});
+	k.push_back({"scalar", "operator/", binary<_Tp>([](const z &a, const z &b) { return a / b; })});
+	k.push_back({"scalar", "abs", unary<_Tp>([](const z &a) { return z(abs(a)); })});
+	k.push_back({"scalar", "arg", unary<_Tp>([](const z &a) { return z(arg(a)); })});
+	k.push_back({"scalar", "norm", unary<_Tp>([](const z &a) { return z(norm(a)); })});
+	k.push_back({"scalar", "polar",
+				 [](inputs<_Tp> &in)
+				 {
+					 for (std::size_t i = 0; i < in.rho.size(); ++i)
+					 {
+						 in.out[i] = hypercomplex::polar(in.rho[i], in.theta[i]);
+					 }
+				 }});
+	k.push_back({"scalar", "exp", unary<_Tp>([](const z &a) { return exp(a); })});
+	k.push_back({"scalar", "log", unary<_Tp>([](const z &a) { return log(a); })});
+	k.push_back({"scalar", "cos", unary<_Tp>([](const z &a) { return cos(a); })});
+	k.push_back({"scalar", "sin", unary<_Tp>([](const z &a) { return sin(a); })});
+	k.push_back({"scalar", "cosh", unary<_Tp>([](const z &a) { return cosh(a); })});
+	k.push_back({"scalar", "sinh", unary<_Tp>([](const z &a) { return sinh(a); })});
+	k.push_back({"scalar", "pow_int", unary<_Tp>([](const z &a) { return pow(a, 5); })});
+	k.push_back({"scalar", "pow_real", unary<_Tp>([](const z &a) { return pow(a, _Tp(2.5)); })});
+
+	k.push_back({"batch", "add", [](inputs<_Tp> &in) { hypercomplex::add<_Tp>(in.a, in.b, in.out); }});
+	k.push_back({"batch", "subtract", [](inputs<_Tp> &in) { hypercomplex::subtract<_Tp>(in.a, in.b, in.out); }});
+	k.push_back({"batch", "multiply", [](inputs<_Tp> &in) { hypercomplex::multiply<_Tp>(in.a, in.b, in.out); }});
+	k.push_back({"batch", "divide", [](inputs<_Tp> &in) { hypercomplex::divide<_Tp>(in.a, in.b, in.out); }});
+	k.push_back({"batch", "pow_int", [](inputs<_Tp> &in) { hypercomplex::pow<_Tp>(in.a, 5, in.out); }});
+	const std::pair<const char *, accuracy> levels[]
+		= {{"batch_fast", accuracy::fast}, {"batch_balanced", accuracy::balanced}, {"batch_precise", accuracy::precise}};
+	for (const auto &[backend, level] : levels)
+	{
+		const accuracy acc = level;
+		k.push_back({backend, "to_polar",
+					 [acc](inputs<_Tp> &in) { hypercomplex::to_polar<_Tp>(in.a, in.mag, in.phase, acc); }});
+		k.push_back({backend, "from_polar",
+					 [acc](inputs<_Tp> &in) { hypercomplex::from_polar<_Tp>(in.rho, in.theta, in.out, acc); }});
+		k.push_back({backend, "pow_real",
+					 [acc](inputs<_Tp> &in) { hypercomplex::pow<_Tp>(in.a, _Tp(2.5), in.out, acc); }});
+		k.push_back({backend, "pow_complex",
+					 [acc](inputs<_Tp> &in) { hypercomplex::pow<_Tp>(in.a, z(_Tp(0.5), _Tp(1)), in.out, acc); }});
+	}
+	std::vector<z> taps(256);
+	for (std::size_t i = 0; i < taps.size(); ++i)
+	{
+		taps[i] = z(_Tp(1) / _Tp(i + 1), _Tp(0.5) / _Tp(i + 1));
+	}
+	for (const std::size_t block : {std::size_t(64), std::size_t(0)})
+	{
+		auto filter = std::make_shared<hypercomplex::fir_filter<_Tp>>(taps, hypercomplex::fir_method::overlap_save);
+		k.push_back({"fir", block != 0 ? "overlap_save_64" : "overlap_save_whole",
+					 [filter, block](inputs<_Tp> &in)
+					 {
+						 const std::size_t step = block != 0 ? block : in.a.size();
+						 for (std::size_t i = 0; i < in.a.size(); i += step)
+						 {
+							 filter->process(in.a.data() + i, in.out.data() + i, std::min(step, in.a.size() - i));
+						 }
+					 }});
+	}
+	k.push_back({"solver", "lu_factor",
+				 [](inputs<_Tp> &in)
+				 {
+					 const hypercomplex::lu_decomposition<_Tp> lu(in.square);
+					 in.out[0] = lu.factors()(0, 0);
+				 }});
+	return k;
+}
+
+// One warm-up call, then whole calls until min_ms has passed, with the
+// counters running over exactly the timed calls
+template <typename _Tp>
+row
+measure(const options &opt, perf_counters &pmu, const kernel<_Tp> &k, inputs<_Tp> &in)
+{
+	using clock = std::chrono::steady_clock;
+	k.run(in);
+	std::size_t reps = 0;
+	pmu.start();
+	const auto start = clock::now();
+	auto elapsed = clock::duration::zero(), best = clock::duration::max();
+	while (reps < 3 || elapsed < std::chrono::duration<double, std::milli>(opt.min_ms))
+	{
+		const auto call = clock::now();
+		k.run(in);
+		++reps;
+		const auto now = clock::now();
+		best = std::min(best, now - call);
+		elapsed = now - start;
+	}
+	counter_values counts = pmu.stop();
+	const double elements = static_cast<double>(reps * opt.size);
+	for (double &c : counts)
+	{
+		c /= elements;
+	}
+	return row{type_name<_Tp>(),
+			   k.backend,
+			   k.name,
+			   opt.size,
+			   std::chrono::duration<double, std::nano>(elapsed).count() / elements,
+			   std::chrono::duration<double, std::nano>(best).count() / static_cast<double>(opt.size),
+			   counts};
+}
+
+template <typename _Tp>
+void
+run_type(const options &opt, perf_counters &pmu, std::vector<row> &rows)
+{
+	inputs<_Tp> in = make_inputs<_Tp>(opt);
+	for (const auto &k : kernels<_Tp>())
+	{
+		const std::string label = std::string(k.backend) + "/" + k.name;
+		if (opt.filter.empty() || label.find(opt.filter) != std::string::npos)
+		{
+			rows.push_back(measure(opt, pmu, k, in));
+		}
+	}
+}
+
+double
+ipc(const row &r)
+{
+	return r.counts[instructions] / r.counts[cycles];
+}
+
+// A missing counter (NaN) prints as missing
+void
+print_value(double v, const char *missing)
+{
+	if (std::isnan(v))
+	{
+		std::printf("%s", missing);
+	}
+	else
+	{
+		std::printf("%.4g", v);
+	}
+}
+
+void
+print_csv(const std::vector<row> &rows)
+{
+	std::printf("type,backend,kernel,size,ns,ns_best,ipc");
+	for (const char *name : counter_names)
+	{
+		std::printf(",%s", name);
+	}
+	std::printf("\n");
+	for (const row &r : rows)
+	{
+		std::printf("%s,%s,%s,%zu,%.4f,%.4f,", r.type.c_str(), r.backend.c_str(), r.kernel.c_str(), r.size, r.ns,
+					r.ns_best);
+		print_value(ipc(r), "");
+		for (double v : r.counts)
+		{
+			std::printf(",");
+			print_value(v, "");
+		}
+		std::printf("\n");
+	}
+}
+
+void
+print_json(const std::vector<row> &rows, const perf_counters &pmu)
+{
+	std::printf("{\n  \"counters\": \"%s\",\n  \"results\": [\n", pmu.status().c_str());
+	for (std::size_t i = 0; i < rows.size(); ++i)
+	{
+		const row &r = rows[i];
+		std::printf("    {\"type\": \"%s\", \"backend\": \"%s\", \"kernel\": \"%s\", \"size\": %zu, \"ns\": %.4f, "
+					"\"ns_best\": %.4f, \"ipc\": ",
+					r.type.c_str(), r.backend.c_str(), r.kernel.c_str(), r.size, r.ns, r.ns_best);
+		print_value(ipc(r), "null");
+		for (std::size_t c = 0; c < counter_count; ++c)
+		{
+			std::printf(", \"%s\": ", counter_names[c]);
+			print_value(r.counts[c], "null");
+		}
+		std::printf("}%s\n", i + 1 < rows.size() ? "," : "");
+	}
+	std::printf("  ]\n}\n");
+}
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+	options opt;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+		{
+			opt.json = std::strcmp(argv[++i], "json") == 0;
+		}
+		else if (std::strcmp(argv[i], "--size") == 0 && i + 1 < argc)
+		{
+			opt.size = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+		{
+			opt.min_ms = std::strtod(argv[++i], nullptr);
+		}
+		else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+		{
+			opt.seed = std::strtoull(argv[++i], nullptr, 10);
+		}
+		else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+		{
+			opt.filter = argv[++i];
+		}
+		else if (std::strcmp(argv[i], "--scalar-event") == 0 && i + 1 < argc)
+		{
+			opt.scalar_event = std::strtoull(argv[++i], nullptr, 0);
+		}
+		else if (std::strcmp(argv[i], "--vector-event") == 0 && i + 1 < argc)
+		{
+			opt.vector_event = std::strtoull(argv[++i], nullptr, 0);
+		}
+		else
+		{
+			std::fprintf(stderr,
+						 "usage: %s [--format csv|json] [--size N] [--min-time MS] [--seed S] [--filter TEXT]\n"
+						 "          [--scalar-event RAW] [--vector-event RAW]\n",
+						 argv[0]);
+			return 2;
+		}
+	}
+	if (opt.size == 0)
+	{
+		std::fprintf(stderr, "%s: --size must be positive\n", argv[0]);
+		return 2;
+	}
+
+	perf_counters pmu(opt);
+	if (!pmu.any())
+	{
+		std::fprintf(stderr, "%s: no hardware counters, reporting wall time only: %s\n", argv[0],
+					 pmu.status().c_str());
+	}
+	std::vector<row> rows;
+	run_type<float>(opt, pmu, rows);
+	run_type<double>(opt, pmu, rows);
+	opt.json ? print_json(rows, pmu) : print_csv(rows);
+	return 0;
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : benchmark.cpp
+// footer-end --------------------------------------------
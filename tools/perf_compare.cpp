@@ -0,0 +1,205 @@
+// header-begin ------------------------------------------
+// File       : perf_compare.cpp
+//
+// Author      : Joshua E
+// Email       : estesjn2020@gmail.com
+//
+// Created on  : 10/19/2026
+//
+// Comments:
+//      Compares two complex_benchmark --format json result
+//      files kernel by kernel on the fastest call's wall time
+//      per element (ns_best), which holds up better than the
+//      mean against other load on the machine.
+//
+//      Usage: perf_compare BASELINE CURRENT
+//                          [--threshold FRACTION]
+//
+//      A kernel regresses when its time grows by more than
+//      the threshold (default 0.10, i.e. 10%), and the exit
+//      status is then 1. Kernels present in only one file
+//      are listed but do not fail the comparison. A missing
+//      BASELINE exits with 77, which the perf_regression
+//      test reports as skipped; baselines are only written
+//      by the perf_baseline target.
+//
+// header-end --------------------------------------------
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// type/backend/kernel -> ns_best per element
+using results = std::map<std::string, double>;
+
+bool
+read_file(const char *path, std::string &text)
+{
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+	{
+		return false;
+	}
+	std::ostringstream buffer;
+	buffer << in.rdbuf();
+	text = buffer.str();
+	return true;
+}
+
+// Value of "key": in a flat JSON object, without quotes
+std::string
+field(const std::string &object, const char *key)
+{
+	const std::string name = std::string("\"") + key + "\":";
+	std::size_t pos = object.find(name);
+	if (pos == std::string::npos)
+	{
+		return "";
+	}
+	pos = object.find_first_not_of(' ', pos + name.size());
+	if (pos == std::string::npos)
+	{
+		return "";
+	}
+	if (object[pos] == '"')
+	{
+		const std::size_t end = object.find('"', pos + 1);
+		return object.substr(pos + 1, end - pos - 1);
+	}
+	const std::size_t end = object.find_first_of(",}", pos);
+	return object.substr(pos, end - pos);
+}
+
+// The benchmark writes each result as a one-level object inside
+// "results"; this reads exactly that layout
+bool
+parse(const std::string &text, results &out)
+{
+	std::size_t pos = text.find("\"results\"");
+	if (pos == std::string::npos)
+	{
+		return false;
+	}
+	while ((pos = text.find('{', pos)) != std::string::npos)
+	{
+		const std::size_t end = text.find('}', pos);
+		if (end == std::string::npos)
+		{
+			return false;
+		}
+		const std::string object = text.substr(pos, end - pos + 1);
+		const std::string ns = field(object, "ns_best");
+		if (ns.empty())
+		{
+			return false;
+		}
+		out[field(object, "type") + "/" + field(object, "backend") + "/" + field(object, "kernel")]
+			= std::strtod(ns.c_str(), nullptr);
+		pos = end + 1;
+	}
+	return true;
+}
+
+bool
+load(const char *path, results &out)
+{
+	std::string text;
+	if (!read_file(path, text))
+	{
+		std::fprintf(stderr, "perf_compare: cannot read %s\n", path);
+		return false;
+	}
+	if (!parse(text, out))
+	{
+		std::fprintf(stderr, "perf_compare: %s is not a complex_benchmark JSON result file\n", path);
+		return false;
+	}
+	return true;
+}
+} // namespace
+
+int
+main(int argc, char **argv)
+{
+	const char *baseline_path = nullptr, *current_path = nullptr;
+	double threshold = 0.10;
+	for (int i = 1; i < argc; ++i)
+	{
+		if (std::strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+		{
+			threshold = std::strtod(argv[++i], nullptr);
+		}
+		else if (argv[i][0] != '-' && baseline_path == nullptr)
+		{
+			baseline_path = argv[i];
+		}
+		else if (argv[i][0] != '-' && current_path == nullptr)
+		{
+			current_path = argv[i];
+		}
+		else
+		{
+			current_path = nullptr;
+			break;
+		}
+	}
+	if (baseline_path == nullptr || current_path == nullptr || !(threshold >= 0.0))
+	{
+		std::fprintf(stderr, "usage: %s BASELINE CURRENT [--threshold FRACTION]\n", argv[0]);
+		return 2;
+	}
+
+	results current;
+	if (!load(current_path, current))
+	{
+		return 2;
+	}
+	if (!std::ifstream(baseline_path))
+	{
+		std::printf("perf_compare: no baseline at %s, skipping; build perf_baseline to record one\n", baseline_path);
+		return 77;
+	}
+	results baseline;
+	if (!load(baseline_path, baseline))
+	{
+		return 2;
+	}
+
+	std::size_t regressions = 0;
+	std::printf("%-40s %12s %12s %8s\n", "kernel", "baseline_ns", "current_ns", "change");
+	for (const auto &[name, base] : baseline)
+	{
+		const auto it = current.find(name);
+		if (it == current.end())
+		{
+			std::printf("%-40s %12.4f %12s %8s  missing\n", name.c_str(), base, "-", "-");
+			continue;
+		}
+		const double change = base > 0.0 ? it->second / base - 1.0 : 0.0;
+		const bool regressed = change > threshold;
+		regressions += regressed;
+		std::printf("%-40s %12.4f %12.4f %+7.1f%%%s\n", name.c_str(), base, it->second, 100.0 * change,
+					regressed ? "  REGRESSION" : "");
+	}
+	for (const auto &[name, ns] : current)
+	{
+		if (baseline.find(name) == baseline.end())
+		{
+			std::printf("%-40s %12s %12.4f %8s  new\n", name.c_str(), "-", ns, "-");
+		}
+	}
+	std::printf("%zu of %zu kernels slower than the baseline by more than %.1f%%\n", regressions, baseline.size(),
+				100.0 * threshold);
+	return regressions == 0 ? 0 : 1;
+}
+
+// footer-begin ------------------------------------------
+// default.C++
+// File       : perf_compare.cpp
+// footer-end --------------------------------------------